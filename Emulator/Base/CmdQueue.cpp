@@ -12,36 +12,38 @@
 
 namespace vamiga {
 
-void
+bool
 CmdQueue::put(const Cmd &cmd)
 {
-    {   SYNCHRONIZED
-
-        debug(CMD_DEBUG, "%s [%llx]\n", CmdTypeEnum::key(cmd.type), cmd.value);
+    debug(CMD_DEBUG, "%s [%llx]\n", CmdTypeEnum::key(cmd.type), cmd.value);
 
-        if (!queue.isFull()) {
-            queue.write(cmd);
-        } else {
-            warn("Command lost: %s [%llx]\n", CmdTypeEnum::key(cmd.type), cmd.value);
-        }
+    if (!queue.write(cmd)) {
 
-        empty = false;
+        dropped++;
+        warn("Command lost: %s [%llx]\n", CmdTypeEnum::key(cmd.type), cmd.value);
+        return false;
     }
+    return true;
 }
 
 bool
 CmdQueue::poll(Cmd &cmd)
 {
-    if (empty) return false;
+    return queue.read(cmd);
+}
 
-    {   SYNCHRONIZED
+isize
+CmdQueue::drain(std::function<void(const Cmd &)> func, isize max)
+{
+    Cmd cmd;
+    isize count = 0;
 
-        cmd = queue.read();
-        empty = queue.isEmpty();
+    while (count < max && queue.read(cmd)) {
 
-        return true;
+        func(cmd);
+        count++;
     }
+    return count;
 }
 
 }
-
@@ -11,22 +11,23 @@
 
 #include "CmdQueueTypes.h"
 #include "CoreObject.h"
-#include "Synchronizable.h"
-#include "RingBuffer.h"
+#include "Concurrency.h"
 #include <atomic>
+#include <functional>
 
 namespace vamiga {
 
 /// Command queue
-class CmdQueue final : CoreObject, Synchronizable {
+class CmdQueue final : CoreObject {
 
-    /// Ring buffer storing all pending commands
-    util::RingBuffer <Cmd, 128> queue;
+    /// Lock-free buffer storing all pending commands
+    util::MPSCQueue <Cmd, 128> queue;
 
 public:
     
-    /// Indicates if the queue is empty
-    std::atomic<bool> empty = true;
+    /// Number of commands that have been lost due to a full queue
+    std::atomic<isize> dropped = 0;
+
 
     //
     // Methods
@@ -43,11 +44,17 @@ private:
 
 public:
 
-    // Sends a command
-    void put(const Cmd &cmd);
+    /// Indicates if the queue is empty
+    bool isEmpty() const { return queue.isEmpty(); }
+
+    /// Sends a command (can be called from any thread)
+    /// Returns false if the command was dropped because the queue is full
+    bool put(const Cmd &cmd);
 
-    // Polls a command
+    /// Polls a command (must only be called by the emulator thread)
     bool poll(Cmd &cmd);
-};
 
+    /// Processes up to max pending commands (returns the number of commands)
+    isize drain(std::function<void(const Cmd &)> func, isize max = INT64_MAX);
+};
 }
@@ -68,6 +68,9 @@ enum_long(CMD_TYPE)
     // RetroShell
     CMD_RSH_EXECUTE,            ///< Execute a script command
 
+    // Remote servers
+    CMD_SRV_RECEIVE,            ///< Process data received by a remote server
+
     // Experimental
     CMD_FUNC,
 
@@ -127,6 +130,8 @@ struct CmdTypeEnum : vamiga::util::Reflection<CmdTypeEnum, CmdType> {
 
             case CMD_RSH_EXECUTE:           return "RSH_EXECUTE";
 
+            case CMD_SRV_RECEIVE:           return "SRV_RECEIVE";
+
             case CMD_FUNC:                  return "FUNC";
             case CMD_FOCUS:                 return "FOCUS";
 
@@ -167,6 +172,7 @@ typedef struct
 {
     isize port;
     GamePadAction action;
+    double delay;
 }
 GamePadCmd;
 
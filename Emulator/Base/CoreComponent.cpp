@@ -253,13 +253,13 @@ CoreComponent::size(bool recursive)
 }
 
 isize
-CoreComponent::load(const u8 *buffer)
+CoreComponent::load(const u8 *buffer, bool verify)
 {
     assert(!isRunning());
 
     isize result = 0;
 
-    postorderWalk([this, buffer, &result](CoreComponent *c) {
+    postorderWalk([this, buffer, verify, &result](CoreComponent *c) {
 
         const u8 *ptr = buffer + result;
 
@@ -273,7 +273,7 @@ CoreComponent::load(const u8 *buffer)
         isize count = (isize)(reader.ptr - (buffer + result));
 
         // Check integrity
-        if (hash != c->checksum(false) || FORCE_SNAP_CORRUPTED) {
+        if ((verify && hash != c->checksum(false)) || FORCE_SNAP_CORRUPTED) {
             if (SNP_DEBUG) { fatalError; } else { throw Error(VAERROR_SNAP_CORRUPTED); }
         }
 
@@ -287,16 +287,16 @@ CoreComponent::load(const u8 *buffer)
 }
 
 isize
-CoreComponent::save(u8 *buffer)
+CoreComponent::save(u8 *buffer, bool hash)
 {
     isize result = 0;
 
-    postorderWalk([this, buffer, &result](CoreComponent *c) {
+    postorderWalk([this, buffer, hash, &result](CoreComponent *c) {
 
         u8 *ptr = buffer + result;
 
         // Save the checksum for this component
-        write64(ptr, c->checksum(false));
+        write64(ptr, hash ? c->checksum(false) : 0);
 
         // Save the internal state of this component
         SerWriter writer(ptr); *c << writer;
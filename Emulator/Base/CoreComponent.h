@@ -185,12 +185,12 @@ public:
     void hardReset() { reset(true); }
     void softReset() { reset(false); }
 
-    // Loads the internal state from a memory buffer
-    isize load(const u8 *buf) throws;
+    // Loads the internal state from a memory buffer (optionally verifying checksums)
+    isize load(const u8 *buf, bool verify = true) throws;
     virtual void _didLoad() { }
 
-    // Saves the internal state to a memory buffer
-    isize save(u8 *buf);
+    // Saves the internal state to a memory buffer (optionally computing checksums)
+    isize save(u8 *buf, bool hash = true);
     virtual void _didSave() { }
 
 
@@ -33,6 +33,10 @@ Defaults::Defaults()
     setFallback(OPT_AMIGA_SNAP_DELAY,           10);
     setFallback(OPT_AMIGA_SNAP_COMPRESS,        true);
 
+    setFallback(OPT_AMIGA_REWIND,               false);
+    setFallback(OPT_AMIGA_REWIND_KEYS,          50);
+    setFallback(OPT_AMIGA_REWIND_SIZE,          64);
+
     setFallback(OPT_AGNUS_REVISION,             AGNUS_ECS_1MB);
     setFallback(OPT_AGNUS_PTR_DROPS,            true);
     
@@ -112,6 +116,8 @@ Defaults::Defaults()
 
     setFallback(OPT_SER_DEVICE,                 SPD_NONE);
     setFallback(OPT_SER_VERBOSE,                0);
+    setFallback(OPT_SER_BULK,                   false);
+    setFallback(OPT_SER_FAST_BAUD,              0);
 
     setFallback(OPT_DENISE_HIDDEN_BITPLANES,    0);
     setFallback(OPT_DENISE_HIDDEN_SPRITES,      0);
@@ -177,6 +183,8 @@ Defaults::Defaults()
 void
 Defaults::_dump(Category category, std::ostream& os) const
 {
+    SYNCHRONIZED
+
     for (const auto &it: fallbacks) {
         
         const string key = it.first;
@@ -359,6 +367,8 @@ Defaults::save(std::stringstream &stream)
 string
 Defaults::getRaw(const string &key) const
 {
+    SYNCHRONIZED
+
     if (values.contains(key)) return values.at(key);
     if (fallbacks.contains(key)) return fallbacks.at(key);
 
@@ -397,6 +407,8 @@ Defaults::get(Option option, isize nr) const
 string
 Defaults::getFallbackRaw(const string &key) const
 {
+    SYNCHRONIZED
+
     if (fallbacks.contains(key)) return fallbacks.at(key);
 
     throw Error(VAERROR_INVALID_KEY, key);
@@ -297,6 +297,10 @@ Error::Error(ErrorCode code, const string &s)
             description += " emulator into an inconsistent state.";
             break;
 
+        case VAERROR_SNAP_UNAVAILABLE:
+            description = "Frame " + s + " is not stored in the rewind buffer.";
+            break;
+
         case VAERROR_DMS_CANT_CREATE:
             description = "Failed to extract the DMS archive.";
             break;
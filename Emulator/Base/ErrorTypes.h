@@ -108,6 +108,7 @@ enum_long(VAERROR_CODE)
     VAERROR_SNAP_TOO_NEW,         ///< Snapshot was created with a later version
     VAERROR_SNAP_IS_BETA,         ///< Snapshot was created with a beta release
     VAERROR_SNAP_CORRUPTED,       ///< Snapshot data is corrupted
+    VAERROR_SNAP_UNAVAILABLE,     ///< Frame is not stored in the rewind buffer
 
     // Media files
     VAERROR_DMS_CANT_CREATE,
@@ -291,6 +292,7 @@ struct ErrorCodeEnum : vamiga::util::Reflection<ErrorCodeEnum, ErrorCode>
             case VAERROR_SNAP_TOO_OLD:                return "SNAP_TOO_OLD";
             case VAERROR_SNAP_TOO_NEW:                return "SNAP_TOO_NEW";
             case VAERROR_SNAP_IS_BETA:                return "SNAP_IS_BETA";
+            case VAERROR_SNAP_UNAVAILABLE:            return "SNAP_UNAVAILABLE";
 
             case VAERROR_DMS_CANT_CREATE:             return "DMS_CANT_CREATE";
             case VAERROR_EXT_FACTOR5:                 return "EXT_UNSUPPORTED";
@@ -40,6 +40,9 @@ class Host final : public SubComponent {
     // Current configuration
     HostConfig config = { };
 
+    // Folder for temporary files (determined on first use)
+    mutable fs::path tmpDir;
+
 
     //
     // Initializing
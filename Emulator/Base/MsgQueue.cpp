@@ -17,41 +17,43 @@ MsgQueue::setListener(const void *listener, Callback *callback)
 {
     {   SYNCHRONIZED
         
-        this->listener = listener;
         this->callback = callback;
+        this->listener = listener;
         
         // Send all pending messages
-        while (!queue.isEmpty()) {
-
-            Message &msg = queue.read();
-            callback(listener, msg);
-        }        
+        flush();
     }
 }
 
 void
 MsgQueue::put(const Message &msg)
 {
-    if (enabled) {
+    if (!enabled) return;
+
+    debug(MSG_DEBUG, "%s [%llx]\n", MsgTypeEnum::key(msg.type), msg.value);
+
+    if (listener) {
 
         SYNCHRONIZED
 
-        debug(MSG_DEBUG, "%s [%llx]\n", MsgTypeEnum::key(msg.type), msg.value);
+        // Send the message immediately if a lister has been registered
+        if (!isDuplicate(msg)) callback(listener, msg);
+        return;
+    }
 
-        if (listener) {
+    // Otherwise, store it in the ring buffer
+    if (!queue.write(msg)) {
 
-            // Send the message immediately if a lister has been registered
-            callback(listener, msg); return;
+        dropped++;
+        warn("Message lost: %s [%llx]\n", MsgTypeEnum::key(msg.type), msg.value);
+    }
 
-        } else {
+    // Don't leave the message behind if a listener has shown up in the meantime
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (listener) {
 
-            // Otherwise, store it in the ring buffer
-            if (!queue.isFull()) {
-                queue.write(msg);
-            } else {
-                warn("Message lost: %s [%llx]\n", MsgTypeEnum::key(msg.type), msg.value);
-            }
-        }
+        SYNCHRONIZED
+        flush();
     }
 }
 
@@ -102,10 +104,77 @@ MsgQueue::get(Message &msg)
 {
     {   SYNCHRONIZED
 
-        if (queue.isEmpty()) return false;
+        while (queue.read(msg)) {
+            if (!isDuplicate(msg)) return true;
+        }
+        return false;
+    }
+}
+
+isize
+MsgQueue::drain(std::function<void(const Message &)> func, isize max)
+{
+    {   SYNCHRONIZED
+
+        Message msg;
+        isize count = 0;
+
+        while (count < max && queue.read(msg)) {
+
+            if (isDuplicate(msg)) continue;
+
+            func(msg);
+            count++;
+        }
+        return count;
+    }
+}
+
+bool
+MsgQueue::isDuplicate(const Message &msg)
+{
+    bool idempotent = false;
+
+    // Messages reporting a state are redundant if the state hasn't changed
+    switch (msg.type) {
+
+        case MSG_WARP:
+        case MSG_TRACK:
+        case MSG_MUTE:
+        case MSG_POWER_LED_ON:
+        case MSG_POWER_LED_DIM:
+        case MSG_POWER_LED_OFF:
+        case MSG_VIEWPORT:
+        case MSG_DRIVE_SELECT:
+        case MSG_DRIVE_READ:
+        case MSG_DRIVE_WRITE:
+        case MSG_DRIVE_LED:
+        case MSG_DRIVE_MOTOR:
+        case MSG_HDR_READ:
+        case MSG_HDR_WRITE:
+        case MSG_HDR_IDLE:
+
+            // The payload of all these messages is covered by 'value'
+            idempotent = msg.type == last.type && msg.value == last.value;
+            break;
+
+        default:
+            break;
+    }
+
+    if (idempotent) { coalesced++; return true; }
+
+    last = msg;
+    return false;
+}
+
+void
+MsgQueue::flush()
+{
+    Message msg;
 
-        msg = queue.read();
-        return true;
+    while (queue.read(msg)) {
+        if (!isDuplicate(msg)) callback(listener, msg);
     }
 }
 
@@ -12,17 +12,18 @@
 #include "MsgQueueTypes.h"
 #include "CoreObject.h"
 #include "Synchronizable.h"
-#include "RingBuffer.h"
+#include <atomic>
+#include <functional>
 
 namespace vamiga {
 
 class MsgQueue final : CoreObject, Synchronizable {
 
-    // Ring buffer storing all pending messages
-    util::RingBuffer <Message, 512> queue;
+    // Lock-free buffer storing all pending messages
+    util::MPSCQueue <Message, 512> queue;
 
     // The registered listener
-    const void *listener = nullptr;
+    std::atomic<const void *> listener = nullptr;
     
     // The registered callback function
     Callback *callback = nullptr;
@@ -30,6 +31,17 @@ class MsgQueue final : CoreObject, Synchronizable {
     // If disabled, no messages will be stored
     bool enabled = true;
 
+    // The most recently delivered message (used for coalescing)
+    Message last = { };
+
+public:
+
+    // Number of messages that have been lost due to a full queue
+    std::atomic<isize> dropped = 0;
+
+    // Number of messages that have been skipped as duplicates
+    std::atomic<isize> coalesced = 0;
+
 
     //
     // Constructing
@@ -78,6 +90,17 @@ public:
 
     // Reads a message
     bool get(Message &msg);
+
+    // Passes up to max pending messages to a callback (returns the count)
+    isize drain(std::function<void(const Message &)> func, isize max = INT64_MAX);
+
+private:
+
+    // Checks if a message only repeats the previous one
+    bool isDuplicate(const Message &msg);
+
+    // Delivers all pending messages to the listener
+    void flush();
 };
 
 }
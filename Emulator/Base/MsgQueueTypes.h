@@ -113,6 +113,9 @@ enum_long(MSG_TYPE)
     MSG_RECORDING_STARTED,
     MSG_RECORDING_STOPPED,
     MSG_RECORDING_ABORTED,
+
+    // Input recording
+    MSG_REPLAY_FINISHED,
         
     // DMA Debugging
     MSG_DMA_DEBUG,
@@ -216,6 +219,8 @@ struct MsgTypeEnum : vamiga::util::Reflection<MsgTypeEnum, MsgType>
             case MSG_RECORDING_STARTED:     return "RECORDING_STARTED";
             case MSG_RECORDING_STOPPED:     return "RECORDING_STOPPED";
             case MSG_RECORDING_ABORTED:     return "RECORDING_ABORTED";
+
+            case MSG_REPLAY_FINISHED:       return "REPLAY_FINISHED";
                                 
             case MSG_DMA_DEBUG:             return "DMA_DEBUG";
                                 
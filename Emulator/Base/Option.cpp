@@ -41,6 +41,10 @@ OptionParser::create(Option opt, i64 arg)
         case OPT_AMIGA_SNAP_DELAY:          return numParser(" sec");
         case OPT_AMIGA_SNAP_COMPRESS:       return boolParser();
 
+        case OPT_AMIGA_REWIND:              return boolParser();
+        case OPT_AMIGA_REWIND_KEYS:         return numParser(" frames");
+        case OPT_AMIGA_REWIND_SIZE:         return numParser(" MB");
+
         case OPT_AGNUS_REVISION:            return enumParser.template operator()<AgnusRevisionEnum>();
         case OPT_AGNUS_PTR_DROPS:           return boolParser();
 
@@ -125,6 +129,8 @@ OptionParser::create(Option opt, i64 arg)
 
         case OPT_SER_DEVICE:                return enumParser.template operator()<SerialPortDeviceEnum>();
         case OPT_SER_VERBOSE:               return boolParser();
+        case OPT_SER_BULK:                  return boolParser();
+        case OPT_SER_FAST_BAUD:             return numParser(" baud");
 
         case OPT_BLITTER_ACCURACY:          return numParser();
 
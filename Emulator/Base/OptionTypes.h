@@ -37,6 +37,11 @@ enum_long(OPT)
     OPT_AMIGA_SNAP_DELAY,       ///< Delay between two snapshots in seconds
     OPT_AMIGA_SNAP_COMPRESS,    ///< Compress snapshot data
 
+    // Rewinding
+    OPT_AMIGA_REWIND,           ///< Record frames for rewinding
+    OPT_AMIGA_REWIND_KEYS,      ///< Number of frames between two keyframes
+    OPT_AMIGA_REWIND_SIZE,      ///< Memory budget of the rewind buffer in MB
+
     // Agnus
     OPT_AGNUS_REVISION,
     OPT_AGNUS_PTR_DROPS,
@@ -135,6 +140,8 @@ enum_long(OPT)
     // Ports
     OPT_SER_DEVICE,
     OPT_SER_VERBOSE,
+    OPT_SER_BULK,               ///< Batch socket writes of the null modem cable
+    OPT_SER_FAST_BAUD,          ///< Baud rate from which on bytes are shifted out at once
 
     // Blitter
     OPT_BLITTER_ACCURACY,
@@ -212,6 +219,10 @@ struct OptionEnum : vamiga::util::Reflection<OptionEnum, Option>
             case OPT_AMIGA_SNAP_DELAY:          return "AMIGA.SNAP_DELAY";
             case OPT_AMIGA_SNAP_COMPRESS:       return "AMIGA.SNAP_COMPRESS";
 
+            case OPT_AMIGA_REWIND:              return "AMIGA.REWIND";
+            case OPT_AMIGA_REWIND_KEYS:         return "AMIGA.REWIND_KEYS";
+            case OPT_AMIGA_REWIND_SIZE:         return "AMIGA.REWIND_SIZE";
+
             case OPT_AGNUS_REVISION:            return "AGNUS.REVISION";
             case OPT_AGNUS_PTR_DROPS:           return "AGNUS.PTR_DROPS";
 
@@ -296,6 +307,8 @@ struct OptionEnum : vamiga::util::Reflection<OptionEnum, Option>
 
             case OPT_SER_DEVICE:                return "SER.DEVICE";
             case OPT_SER_VERBOSE:               return "SER.VERBOSE";
+            case OPT_SER_BULK:                  return "SER.BULK";
+            case OPT_SER_FAST_BAUD:             return "SER.FAST_BAUD";
 
             case OPT_BLITTER_ACCURACY:          return "BLITTER.ACCURACY";
 
@@ -359,6 +372,10 @@ struct OptionEnum : vamiga::util::Reflection<OptionEnum, Option>
             case OPT_AMIGA_SNAP_DELAY:          return "Time span between two snapshots";
             case OPT_AMIGA_SNAP_COMPRESS:       return "Compress snapshot data";
 
+            case OPT_AMIGA_REWIND:              return "Record frames for rewinding";
+            case OPT_AMIGA_REWIND_KEYS:         return "Time span between two keyframes";
+            case OPT_AMIGA_REWIND_SIZE:         return "Memory budget of the rewind buffer";
+
             case OPT_AGNUS_REVISION:            return "Chip revision";
             case OPT_AGNUS_PTR_DROPS:           return "Ignore certain register writes";
 
@@ -443,6 +460,8 @@ struct OptionEnum : vamiga::util::Reflection<OptionEnum, Option>
 
             case OPT_SER_DEVICE:                return "Serial device type";
             case OPT_SER_VERBOSE:               return "Verbose";
+            case OPT_SER_BULK:                  return "Bulk transfer mode";
+            case OPT_SER_FAST_BAUD:             return "Fast path threshold";
 
             case OPT_BLITTER_ACCURACY:          return "Blitter accuracy level";
 
@@ -289,19 +289,23 @@ public:
         return *this;
     }
 
+    /* Only the used part of a buffer is taken into account. Stale elements
+     * outside the fill range differ between otherwise identical states, e.g.,
+     * if Denise skips the rendering of a frame.
+     */
     template <class T, isize N>
     auto& operator<<(util::Array<T, N> &a)
     {
-        for(isize i = 0; i < N; ++i) *this << a.elements[i];
-        *this << a.elements << a.w;
+        for(isize i = 0; i < a.w; ++i) *this << a.elements[i];
+        *this << a.w;
         return *this;
     }
 
     template <class T, isize N>
     auto& operator<<(util::SortedArray<T, N> &a)
     {
-        for(isize i = 0; i < N; ++i) *this << a.elements[i];
-        for(isize i = 0; i < N; ++i) *this << a.keys[i];
+        for(isize i = 0; i < a.w; ++i) *this << a.elements[i];
+        for(isize i = 0; i < a.w; ++i) *this << a.keys[i];
         *this << a.w;
         return *this;
     }
@@ -309,7 +313,7 @@ public:
     template <class T, isize N>
     auto& operator<<(util::RingBuffer<T, N> &a)
     {
-        for(isize i = 0; i < N; ++i) *this << a.elements[i];
+        for(isize i = a.r; i != a.w; i = a.next(i)) *this << a.elements[i];
         *this << a.r << a.w;
         return *this;
     }
@@ -317,8 +321,8 @@ public:
     template <class T, isize N>
     auto& operator<<(util::SortedRingBuffer<T, N> &a)
     {
-        for(isize i = 0; i < N; ++i) *this << a.elements[i];
-        for(isize i = 0; i < N; ++i) *this << a.keys[i];
+        for(isize i = a.r; i != a.w; i = a.next(i)) *this << a.elements[i];
+        for(isize i = a.r; i != a.w; i = a.next(i)) *this << a.keys[i];
         *this << a.r << a.w;
         return *this;
     }
@@ -279,6 +279,9 @@ Thread::pause()
 void
 Thread::halt()
 {
+    // Nothing to do if the thread has never been launched
+    if (!isLaunched()) return;
+
     if (state != STATE_UNINIT && state != STATE_HALTED) {
 
         debug(RUN_DEBUG, "Switching to HALT state...\n");
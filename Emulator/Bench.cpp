@@ -0,0 +1,588 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the Mozilla Public License v2
+//
+// See https://mozilla.org/MPL/2.0 for license information
+// -----------------------------------------------------------------------------
+/// @file
+
+#include "config.h"
+#include "Bench.h"
+#include "BenchPrograms.h"
+#include "Emulator.h"
+#include "DiagRom.h"
+#include "ADFFile.h"
+#include "DMSFile.h"
+#include "FloppyDisk.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+int main(int argc, char *argv[])
+{
+    try {
+
+        return vamiga::Bench().main(argc, argv);
+
+    } catch (vamiga::BenchSyntaxError &e) {
+
+        std::cout << "Usage: vAmigaBench [-l] [-f <text>] [-n <frames>] [-r <count>] [-d <dir>] [-o <file>]" << std::endl;
+        std::cout << std::endl;
+        std::cout << "       -l or --list            List all benchmarks" << std::endl;
+        std::cout << "       -f or --filter <text>   Only run benchmarks containing this text" << std::endl;
+        std::cout << "       -n or --frames <frames> Number of measured frames per workload" << std::endl;
+        std::cout << "       -r or --repeat <count>  Number of repetitions per benchmark" << std::endl;
+        std::cout << "       -d or --dms <dir>       Measure the DMS decoder on all archives in <dir>" << std::endl;
+        std::cout << "       -o or --output <file>   Write the results to a file instead of stdout" << std::endl;
+        std::cout << std::endl;
+
+        if (auto what = string(e.what()); !what.empty()) {
+            std::cout << what << std::endl;
+        }
+
+    } catch (vamiga::Error &e) {
+
+        std::cout << "VAError: " << e.what() << std::endl;
+
+    } catch (std::exception &e) {
+
+        std::cout << "System Error: " << e.what() << std::endl;
+
+    } catch (...) {
+
+        std::cout << "Error" << std::endl;
+    }
+
+    return 1;
+}
+
+namespace vamiga {
+
+int
+Bench::main(int argc, char *argv[])
+{
+    // Parse all command line arguments
+    parseArguments(argc, argv);
+
+    // List all benchmarks if requested
+    if (keys.find("list") != keys.end()) { runAll(true); return 0; }
+
+    // Run all benchmarks
+    runAll(false);
+
+    // Report the results
+    if (keys.find("output") != keys.end()) {
+
+        std::ofstream stream(keys["output"]);
+        if (!stream.is_open()) throw Error(VAERROR_FILE_CANT_CREATE, keys["output"]);
+        report(stream);
+
+    } else {
+
+        report(std::cout);
+    }
+
+    return 0;
+}
+
+void
+Bench::parseArguments(int argc, char *argv[])
+{
+    for (isize i = 1; i < argc; i++) {
+
+        auto arg = string(argv[i]);
+
+        if (arg == "-l" || arg == "--list") { keys["list"] = "1"; continue; }
+
+        if (arg[0] != '-') throw BenchSyntaxError("Invalid argument '" + arg + "'");
+        if (++i == argc) throw BenchSyntaxError("Missing argument for '" + arg + "'");
+        auto value = string(argv[i]);
+
+        if (arg == "-f" || arg == "--filter") { keys["filter"] = value; continue; }
+        if (arg == "-n" || arg == "--frames") { frames = parseNum(value); continue; }
+        if (arg == "-r" || arg == "--repeat") { repeat = parseNum(value); continue; }
+        if (arg == "-o" || arg == "--output") { keys["output"] = value; continue; }
+
+        if (arg == "-d" || arg == "--dms") {
+
+            if (!util::isDirectory(value)) throw BenchSyntaxError("Directory " + value + " does not exist");
+            keys["dms"] = std::filesystem::absolute(value).string();
+            continue;
+        }
+
+        throw BenchSyntaxError("Invalid option '" + arg + "'");
+    }
+}
+
+isize
+Bench::parseNum(const string &arg) const
+{
+    try {
+
+        size_t pos;
+        auto result = std::stol(arg, &pos);
+        if (pos == arg.size() && result > 0) return isize(result);
+
+    } catch (...) { }
+
+    throw BenchSyntaxError("Invalid number '" + arg + "'");
+}
+
+void
+Bench::runAll(bool dryRun)
+{
+    auto filter = keys["filter"];
+
+    auto bench = [&](const string &name, const string &unit, std::function<double()> func) {
+
+        if (name.find(filter) == string::npos) return;
+
+        if (dryRun) {
+            std::cout << name << " (" << unit << ")" << std::endl;
+        } else {
+            run(name, unit, func);
+        }
+    };
+
+    //
+    // Frame rate on fixed workloads
+    //
+
+    bench("frames.diagrom", "frames/s", [&]() {
+
+        VAmiga vamiga;
+        vamiga.mem.loadRom(diagROM13, sizeofDiagRom13);
+        configure(vamiga);
+        vamiga.emu->main.powerOn();
+        return measureFrames(vamiga);
+    });
+
+    bench("frames.stress", "frames/s", [&]() {
+
+        VAmiga vamiga;
+        configure(vamiga);
+        boot(vamiga, benchStressProgram, isize(std::size(benchStressProgram)));
+        return measureFrames(vamiga);
+    });
+
+    bench("frames.disk", "frames/s", [&]() {
+
+        VAmiga vamiga;
+        configure(vamiga);
+        boot(vamiga, benchDiskProgram, isize(std::size(benchDiskProgram)));
+        vamiga.emu->main.df0.insertNew(FS_OFS, BB_NONE, "Bench");
+        return measureFrames(vamiga);
+    });
+
+    bench("frames.audio", "frames/s", [&]() {
+
+        VAmiga vamiga;
+        configure(vamiga);
+        boot(vamiga, benchAudioProgram, isize(std::size(benchAudioProgram)));
+        return measureFrames(vamiga);
+    });
+
+    //
+    // Components
+    //
+
+    bench("cpu.alu", "Mcycles/s", [&]() {
+        return measureCpu(benchAluProgram, isize(std::size(benchAluProgram)));
+    });
+
+    bench("cpu.muldiv", "Mcycles/s", [&]() {
+        return measureCpu(benchMulDivProgram, isize(std::size(benchMulDivProgram)));
+    });
+
+    bench("cpu.memory", "Mcycles/s", [&]() {
+        return measureCpu(benchMemoryProgram, isize(std::size(benchMemoryProgram)));
+    });
+
+    bench("cpu.branch", "Mcycles/s", [&]() {
+        return measureCpu(benchBranchProgram, isize(std::size(benchBranchProgram)));
+    });
+
+    bench("blitter.fast", "Mwords/s", [&]() { return measureBlitter(0); });
+    bench("blitter.slow", "Mwords/s", [&]() { return measureBlitter(2); });
+
+    bench("denise.lines", "lines/s", [&]() { return measureDenise(false); });
+    bench("denise.sprites", "lines/s", [&]() { return measureDenise(true); });
+    bench("audio.synthesize", "Msamples/s", [&]() { return measureSynthesizer(); });
+    bench("snapshot.save", "snapshots/s", [&]() { return measureSnapshots(false); });
+    bench("snapshot.load", "snapshots/s", [&]() { return measureSnapshots(true); });
+    bench("media.mfm", "MB/s", [&]() { return measureMFM(); });
+    bench("media.adf", "MB/s", [&]() { return measureDiskEncoder(); });
+
+    if (keys.find("dms") != keys.end()) {
+        bench("media.dms", "MB/s", [&]() { return measureDMS(keys["dms"]); });
+    }
+}
+
+void
+Bench::run(const string &name, const string &unit, std::function<double()> func)
+{
+    Result result = { .name = name, .unit = unit, .values = { } };
+
+    for (isize i = 0; i < repeat; i++) {
+
+        result.values.push_back(func());
+        std::cerr << name << ": " << result.values.back() << " " << unit << std::endl;
+    }
+
+    results.push_back(result);
+}
+
+void
+Bench::report(std::ostream &os) const
+{
+    auto num = [](double value) { std::stringstream ss; ss << value; return ss.str(); };
+
+    os << "{" << std::endl;
+    os << "  \"version\": \"" << VAmiga::version() << "\"," << std::endl;
+    os << "  \"frames\": " << frames << "," << std::endl;
+    os << "  \"repeat\": " << repeat << "," << std::endl;
+    os << "  \"results\": [";
+
+    for (usize i = 0; i < results.size(); i++) {
+
+        auto &r = results[i];
+        auto values = r.values;
+        std::sort(values.begin(), values.end());
+
+        os << (i ? "," : "") << std::endl;
+        os << "    { \"name\": \"" << r.name << "\", \"unit\": \"" << r.unit << "\", ";
+        os << "\"value\": " << num(values[values.size() / 2]) << ", ";
+        os << "\"min\": " << num(values.front()) << ", ";
+        os << "\"max\": " << num(values.back()) << " }";
+    }
+
+    os << std::endl << "  ]" << std::endl << "}" << std::endl;
+}
+
+void
+Bench::configure(VAmiga &vamiga)
+{
+    // Initialize the instance without launching its thread
+    vamiga.emu->initialize();
+
+    // Use a fixed configuration without a hard drive
+    auto &amiga = vamiga.emu->main;
+    amiga.set(OPT_HDC_CONNECT, false, { 0 });
+    amiga.set(OPT_MEM_CHIP_RAM, 512);
+    amiga.set(OPT_MEM_SLOW_RAM, 512);
+    amiga.set(OPT_MEM_FAST_RAM, 0);
+    amiga.set(OPT_MEM_RAM_INIT_PATTERN, RAM_INIT_RANDOMIZED);
+}
+
+void
+Bench::boot(VAmiga &vamiga, const u16 *code, isize count)
+{
+    auto &amiga = vamiga.emu->main;
+    auto &mem = amiga.mem;
+
+    // Assemble the Rom
+    mem.allocRom(KB(256));
+    std::memset(mem.rom, 0, KB(256));
+
+    isize pos = 0;
+    auto emit = [&](const u16 *words, isize count) {
+        for (isize i = 0; i < count; i++, pos += 2) W16BE(mem.rom + pos, words[i]);
+    };
+    emit(benchVectors, isize(std::size(benchVectors)));
+    emit(benchPrologue, isize(std::size(benchPrologue)));
+    emit(code, count);
+
+    // Power on and provide the program data
+    amiga.powerOn();
+    setupChipRam(amiga);
+}
+
+void
+Bench::setupChipRam(Amiga &amiga)
+{
+    auto &mem = amiga.mem;
+
+    // Write into Chip Ram directly (the Rom overlay is still active)
+    auto poke16 = [&](u32 addr, u32 value) { W16BE(mem.chip + addr, u16(value)); };
+
+    // Pseudo-random bitplane data and blitter sources
+    u32 seed = 1;
+    auto fill = [&](u32 addr, isize bytes) {
+
+        for (isize i = 0; i < bytes; i += 2) {
+
+            seed = seed * 1664525 + 1013904223;
+            poke16(u32(addr + i), seed >> 16);
+        }
+    };
+    fill(0x20000, 5 * 0x2800);
+    fill(0x30000, 0x2800);
+    fill(0x34000, 0x2800);
+
+    // Triangle wave for the audio channels
+    for (isize i = 0; i < 256; i++) {
+        mem.chip[0x38000 + i] = u8(i < 128 ? 2 * i - 128 : 383 - 2 * i);
+    }
+
+    // Eight overlapping sprites
+    for (u32 i = 0; i < 8; i++) {
+
+        u32 addr = 0x40000 + i * 0x200;
+        u32 vstart = 0x40 + 8 * i, vstop = vstart + 64, hstart = 0x60 + 12 * i;
+
+        poke16(addr, (vstart & 0xFF) << 8 | (hstart >> 1));
+        poke16(addr + 2, (vstop & 0xFF) << 8 | (hstart & 1));
+        for (u32 line = 0; line < 64; line++) {
+
+            poke16(addr + 4 + 4 * line, 0xFFFF >> (line & 15));
+            poke16(addr + 6 + 4 * line, 0x0FF0 ^ line);
+        }
+        poke16(addr + 4 + 4 * 64, 0);
+        poke16(addr + 6 + 4 * 64, 0);
+    }
+
+    // Copper list with many color changes per line
+    std::vector<u16> cop;
+    auto move = [&](u16 reg, u32 value) { cop.push_back(reg); cop.push_back(u16(value)); };
+    auto wait = [&](u32 pos) { cop.push_back(u16(pos | 1)); cop.push_back(0xFFFE); };
+
+    for (u16 i = 0; i < 5; i++) {
+
+        move(0xE0 + 4 * i, (0x20000 + i * 0x2800) >> 16);
+        move(0xE2 + 4 * i, (0x20000 + i * 0x2800) & 0xFFFF);
+    }
+    for (u16 i = 0; i < 8; i++) {
+
+        move(0x120 + 4 * i, (0x40000 + i * 0x200) >> 16);
+        move(0x122 + 4 * i, (0x40000 + i * 0x200) & 0xFFFF);
+    }
+    move(0x100, 0x5200);    // BPLCON0
+    move(0x102, 0x0000);    // BPLCON1
+    move(0x104, 0x0024);    // BPLCON2
+    move(0x108, 0x0000);    // BPL1MOD
+    move(0x10A, 0x0000);    // BPL2MOD
+    move(0x08E, 0x2C81);    // DIWSTRT
+    move(0x090, 0x2CC1);    // DIWSTOP
+    move(0x092, 0x0038);    // DDFSTRT
+    move(0x094, 0x00D0);    // DDFSTOP
+    move(0x098, 0xF7C1);    // CLXCON
+
+    for (u32 y = 0x2C; y <= 0xFF; y++) {
+
+        wait(y << 8 | 0x07);
+        for (u16 i = 0; i < 8; i++) move(0x180 + 2 * i, ((y + 17 * i) * 0x123) & 0xFFF);
+        wait(y << 8 | 0x71);
+        move(0x180, (y * 0x321) & 0xFFF);
+        move(0x102, (y & 0xF) * 0x11);
+    }
+    cop.push_back(0xFFFF);
+    cop.push_back(0xFFFE);
+
+    for (usize i = 0; i < cop.size(); i++) poke16(u32(0x10000 + 2 * i), cop[i]);
+}
+
+void
+Bench::warmUp(Amiga &amiga)
+{
+    for (isize i = 0; i < 50; i++) amiga.computeFrame();
+}
+
+double
+Bench::emulate(Amiga &amiga)
+{
+    auto start = util::Time::now();
+    for (isize i = 0; i < frames; i++) amiga.computeFrame();
+    return double((util::Time::now() - start).asNanoseconds()) / 1e9;
+}
+
+double
+Bench::measureFrames(VAmiga &vamiga)
+{
+    auto &amiga = vamiga.emu->main;
+
+    warmUp(amiga);
+    return double(frames) / emulate(amiga);
+}
+
+double
+Bench::measureCpu(const u16 *code, isize count)
+{
+    VAmiga vamiga;
+    configure(vamiga);
+    boot(vamiga, code, count);
+
+    auto &amiga = vamiga.emu->main;
+    warmUp(amiga);
+
+    auto cycles = amiga.cpu.getClock();
+    auto elapsed = emulate(amiga);
+    return double(amiga.cpu.getClock() - cycles) / elapsed / 1e6;
+}
+
+double
+Bench::measureBlitter(isize accuracy)
+{
+    VAmiga vamiga;
+    configure(vamiga);
+    vamiga.emu->main.set(OPT_BLITTER_ACCURACY, accuracy);
+    boot(vamiga, benchBlitterProgram, isize(std::size(benchBlitterProgram)));
+
+    auto &amiga = vamiga.emu->main;
+    warmUp(amiga);
+
+    // The program counts the blits in Chip Ram
+    auto blits = R32BE(amiga.mem.chip + 0x3C000);
+    auto elapsed = emulate(amiga);
+    blits = R32BE(amiga.mem.chip + 0x3C000) - blits;
+
+    // Each blit writes 20 x 256 words
+    return double(blits) * 20 * 256 / elapsed / 1e6;
+}
+
+double
+Bench::measureDenise(bool spritesOnly)
+{
+    VAmiga vamiga;
+    configure(vamiga);
+    boot(vamiga, benchStressProgram, isize(std::size(benchStressProgram)));
+
+    auto &amiga = vamiga.emu->main;
+    auto &denise = amiga.denise;
+    warmUp(amiga);
+
+    /* Render a fixed number of lines, starting with the state of the last
+     * emulated line. The first line consumes all recorded register changes.
+     * All other lines are rendered with the same register values and with
+     * all sprites armed.
+     */
+    auto lines = frames * VPOS_CNT_PAL;
+    auto start = util::Time::now();
+
+    for (isize i = 0; i < lines; i++) {
+
+        denise.wasArmed = 0xFF;
+        if (!spritesOnly) denise.translate();
+        denise.drawSprites();
+        if (!spritesOnly) denise.pixelEngine.colorize(26 + i % (VPOS_CNT_PAL - 26));
+    }
+
+    auto elapsed = double((util::Time::now() - start).asNanoseconds()) / 1e9;
+    return double(lines) / elapsed;
+}
+
+double
+Bench::measureSynthesizer()
+{
+    VAmiga vamiga;
+    configure(vamiga);
+    boot(vamiga, benchAudioProgram, isize(std::size(benchAudioProgram)));
+
+    auto &amiga = vamiga.emu->main;
+    auto &port = amiga.audioPort;
+    warmUp(amiga);
+    port.unmute();
+
+    // Synthesize the most recent frame over and over again
+    constexpr isize samples = 882;
+    auto target = amiga.agnus.clock;
+    auto clock = target - DMA_CYCLES(HPOS_CNT_PAL * VPOS_CNT_PAL);
+
+    i64 ns = 0;
+    for (isize i = 0; i < 64; i++) {
+
+        port.clear();
+
+        auto start = util::Time::now();
+        for (isize j = 0; j < 16; j++) port.synthesize(clock, target, samples);
+        ns += (util::Time::now() - start).asNanoseconds();
+    }
+
+    return double(64 * 16 * samples) / double(ns) * 1e3;
+}
+
+double
+Bench::measureSnapshots(bool restore)
+{
+    constexpr isize count = 20;
+
+    VAmiga vamiga;
+    configure(vamiga);
+    boot(vamiga, benchStressProgram, isize(std::size(benchStressProgram)));
+
+    auto &amiga = vamiga.emu->main;
+    warmUp(amiga);
+
+    std::unique_ptr<MediaFile> snapshot(amiga.takeSnapshot());
+
+    auto start = util::Time::now();
+    for (isize i = 0; i < count; i++) {
+
+        if (restore) {
+            amiga.loadSnapshot(*snapshot);
+        } else {
+            delete amiga.takeSnapshot();
+        }
+    }
+    return double(count) / double((util::Time::now() - start).asNanoseconds()) * 1e9;
+}
+
+double
+Bench::measureMFM()
+{
+    constexpr isize count = 2000;
+    constexpr isize bytes = 11 * 512;
+
+    std::vector<u8> src(bytes), dst(2 * bytes);
+    for (isize i = 0; i < bytes; i++) src[i] = u8(i * 7 + (i >> 5));
+
+    auto start = util::Time::now();
+    for (isize i = 0; i < count; i++) {
+
+        src[0] = u8(i);
+        FloppyDisk::encodeMFM(dst.data(), src.data(), bytes);
+    }
+    auto ns = (util::Time::now() - start).asNanoseconds();
+
+    return double(count * bytes) / double(ns) * 1e3;
+}
+
+double
+Bench::measureDiskEncoder()
+{
+    constexpr isize count = 20;
+
+    ADFFile adf(INCH_35, DENSITY_DD);
+
+    auto start = util::Time::now();
+    for (isize i = 0; i < count; i++) FloppyDisk disk(adf);
+    auto ns = (util::Time::now() - start).asNanoseconds();
+
+    return double(count * adf.data.size) / double(ns) * 1e3;
+}
+
+double
+Bench::measureDMS(const std::filesystem::path &dir)
+{
+    i64 bytes = 0, ns = 0;
+
+    for (const auto &entry : std::filesystem::directory_iterator(dir)) {
+
+        auto path = entry.path();
+        if (!DMSFile::isCompatible(path)) continue;
+
+        auto start = util::Time::now();
+        DMSFile dms(path);
+        FloppyDisk disk(dms);
+        ns += (util::Time::now() - start).asNanoseconds();
+
+        bytes += dms.numCyls() * dms.numHeads() * dms.numSectors() * 512;
+    }
+
+    if (bytes == 0) throw Error(VAERROR_FILE_NOT_FOUND, dir.string());
+    return double(bytes) / double(ns) * 1e3;
+}
+
+}
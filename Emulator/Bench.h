@@ -0,0 +1,142 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the Mozilla Public License v2
+//
+// See https://mozilla.org/MPL/2.0 for license information
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "VAmiga.h"
+#include <functional>
+#include <map>
+
+namespace vamiga {
+
+struct BenchSyntaxError : public std::runtime_error {
+    using runtime_error::runtime_error;
+};
+
+/* vAmigaBench measures the performance of the emulator core on a fixed set of
+ * workloads. Each benchmark creates a fresh emulator instance with the same
+ * configuration and emulates frames in the calling thread, so the results do
+ * not depend on the thread scheduler or on the host's display refresh rate.
+ * All results are throughput values (higher is better). They are written in
+ * JSON format to make them easy to track in a CI pipeline.
+ */
+class Bench {
+
+    struct Result {
+
+        // Name of the benchmark and unit of the measured values
+        string name;
+        string unit;
+
+        // Measured values (one per repetition)
+        std::vector<double> values;
+    };
+
+    // Parsed command line arguments
+    std::map<string,string> keys;
+
+    // Number of measured frames per workload
+    isize frames = 200;
+
+    // Number of repetitions per benchmark
+    isize repeat = 3;
+
+    // Collected results
+    std::vector<Result> results;
+
+
+    //
+    // Launching
+    //
+
+public:
+
+    // Main entry point
+    int main(int argc, char *argv[]);
+
+private:
+
+    // Parses the command line arguments
+    void parseArguments(int argc, char *argv[]);
+
+    // Converts a number
+    isize parseNum(const string &arg) const;
+
+
+    //
+    // Running benchmarks
+    //
+
+private:
+
+    // Runs all benchmarks whose name matches the filter
+    void runAll(bool dryRun);
+
+    // Runs a single benchmark 'repeat' times and records the results
+    void run(const string &name, const string &unit, std::function<double()> func);
+
+    // Writes all results in JSON format
+    void report(std::ostream &os) const;
+
+
+    //
+    // Setting up workloads
+    //
+
+private:
+
+    // Applies the benchmark configuration to a new emulator instance
+    void configure(VAmiga &vamiga);
+
+    // Installs one of the synthetic programs and powers on the emulator
+    void boot(VAmiga &vamiga, const u16 *code, isize count);
+
+    // Writes the data used by the synthetic programs into Chip Ram
+    void setupChipRam(class Amiga &amiga);
+
+    // Emulates some frames to reach a steady state
+    void warmUp(class Amiga &amiga);
+
+    // Emulates the measured frames and returns the elapsed host time in seconds
+    double emulate(class Amiga &amiga);
+
+
+    //
+    // Benchmarks
+    //
+
+private:
+
+    // Measures the number of emulated frames per second
+    double measureFrames(VAmiga &vamiga);
+
+    // Measures the number of emulated CPU cycles per second (in millions)
+    double measureCpu(const u16 *code, isize count);
+
+    // Measures the number of words per second written by the Blitter (in millions)
+    double measureBlitter(isize accuracy);
+
+    // Measures the number of lines per second rendered by Denise
+    double measureDenise(bool spritesOnly);
+
+    // Measures the number of synthesized audio samples per second (in millions)
+    double measureSynthesizer();
+
+    // Measures the number of snapshots taken or restored per second
+    double measureSnapshots(bool restore);
+
+    // Measures the MFM encoder and the disk encoder (in MB per second)
+    double measureMFM();
+    double measureDiskEncoder();
+
+    // Measures the DMS decoder on a corpus of archives (in MB per second)
+    double measureDMS(const std::filesystem::path &dir);
+};
+
+}
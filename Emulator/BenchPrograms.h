@@ -0,0 +1,196 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the Mozilla Public License v2
+//
+// See https://mozilla.org/MPL/2.0 for license information
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "BasicTypes.h"
+
+/* Synthetic 68000 programs used by vAmigaBench. Each program is installed in
+ * a 256 KB Rom behind the common prologue below. All branches are relative,
+ * so the programs do not depend on their location. The data they refer to
+ * (Copper lists, bitplanes, sprites, samples) is written into Chip Ram by the
+ * benchmark before the first frame is emulated.
+ */
+
+// Reset vectors (initial SSP and PC)
+static const u16 benchVectors[] = {
+
+    0x0008, 0x0000,                         // SSP = $80000
+    0x00F8, 0x0008                          // PC  = $F80008
+};
+
+// Disables the Rom overlay, all interrupts, and all DMA channels
+static const u16 benchPrologue[] = {
+
+    0x13FC, 0x0003, 0x00BF, 0xE201,         // move.b  #$3, $bfe201
+    0x13FC, 0x0002, 0x00BF, 0xE001,         // move.b  #$2, $bfe001
+    0x4DF9, 0x00DF, 0xF000,                 // lea     $dff000, A6
+    0x3D7C, 0x7FFF, 0x009A,                 // move.w  #$7fff, INTENA(A6)
+    0x3D7C, 0x7FFF, 0x009C,                 // move.w  #$7fff, INTREQ(A6)
+    0x3D7C, 0x7FFF, 0x0096                  // move.w  #$7fff, DMACON(A6)
+};
+
+// Runs the Copper list at $10000 and blits into the first bitplane forever
+static const u16 benchStressProgram[] = {
+
+    0x2D7C, 0x0001, 0x0000, 0x0080,         // move.l  #$10000, COP1LC(A6)
+    0x3D7C, 0x0000, 0x0088,                 // move.w  #$0, COPJMP1(A6)
+    0x3D7C, 0x83E0, 0x0096,                 // move.w  #$83e0, DMACON(A6)
+    0x2D7C, 0xFFFF, 0xFFFF, 0x0044,         // move.l  #$ffffffff, BLTAFWM(A6)
+
+    0x302E, 0x000E,                         // loop: move.w CLXDAT(A6), D0
+    0x082E, 0x0006, 0x0002,                 // btst    #6, DMACONR(A6)
+    0x66F4,                                 // bne.s   loop
+    0x2D7C, 0x4FCA, 0x4000, 0x0040,         // move.l  #$4fca4000, BLTCON0(A6)
+    0x2D7C, 0x0003, 0x0000, 0x0050,         // move.l  #$30000, BLTAPT(A6)
+    0x2D7C, 0x0003, 0x4000, 0x004C,         // move.l  #$34000, BLTBPT(A6)
+    0x2D7C, 0x0002, 0x0000, 0x0048,         // move.l  #$20000, BLTCPT(A6)
+    0x2D7C, 0x0002, 0x0000, 0x0054,         // move.l  #$20000, BLTDPT(A6)
+    0x2D7C, 0x0000, 0x0000, 0x0060,         // move.l  #$0, BLTCMOD(A6)
+    0x2D7C, 0x0000, 0x0000, 0x0064,         // move.l  #$0, BLTAMOD(A6)
+    0x3D7C, 0x4014, 0x0058,                 // move.w  #$4014, BLTSIZE(A6)
+    0x60B4                                  // bra.s   loop
+};
+
+// Blits 20 x 256 words (ABC -> D) forever and counts the blits at $3c000
+static const u16 benchBlitterProgram[] = {
+
+    0x3D7C, 0x8240, 0x0096,                 // move.w  #$8240, DMACON(A6)
+    0x2D7C, 0xFFFF, 0xFFFF, 0x0044,         // move.l  #$ffffffff, BLTAFWM(A6)
+
+    0x082E, 0x0006, 0x0002,                 // loop: btst #6, DMACONR(A6)
+    0x66F8,                                 // bne.s   loop
+    0x52B9, 0x0003, 0xC000,                 // addq.l  #1, $3c000
+    0x2D7C, 0x4FCA, 0x4000, 0x0040,         // move.l  #$4fca4000, BLTCON0(A6)
+    0x2D7C, 0x0003, 0x0000, 0x0050,         // move.l  #$30000, BLTAPT(A6)
+    0x2D7C, 0x0003, 0x4000, 0x004C,         // move.l  #$34000, BLTBPT(A6)
+    0x2D7C, 0x0002, 0x0000, 0x0048,         // move.l  #$20000, BLTCPT(A6)
+    0x2D7C, 0x0002, 0x0000, 0x0054,         // move.l  #$20000, BLTDPT(A6)
+    0x2D7C, 0x0000, 0x0000, 0x0060,         // move.l  #$0, BLTCMOD(A6)
+    0x2D7C, 0x0000, 0x0000, 0x0064,         // move.l  #$0, BLTAMOD(A6)
+    0x3D7C, 0x4014, 0x0058,                 // move.w  #$4014, BLTSIZE(A6)
+    0x60B2                                  // bra.s   loop
+};
+
+// Steps the head of df0 back and forth and reads a track on each cylinder
+static const u16 benchDiskProgram[] = {
+
+    0x4BF9, 0x00BF, 0xD100,                 // lea     $bfd100, A5
+    0x13FC, 0x00FF, 0x00BF, 0xD300,         // move.b  #$ff, $bfd300
+    0x1ABC, 0x00FF,                         // move.b  #$ff, (A5)
+    0x1ABC, 0x007F,                         // move.b  #$7f, (A5)
+    0x1ABC, 0x0077,                         // move.b  #$77, (A5)
+    0x3D7C, 0x4489, 0x007E,                 // move.w  #$4489, DSKSYNC(A6)
+    0x3D7C, 0x7F00, 0x009E,                 // move.w  #$7f00, ADKCON(A6)
+    0x3D7C, 0x9500, 0x009E,                 // move.w  #$9500, ADKCON(A6)
+    0x3D7C, 0x8210, 0x0096,                 // move.w  #$8210, DMACON(A6)
+
+    0x1C3C, 0x0075,                         // loop: move.b #$75, D6
+    0x6100, 0x000C,                         // bsr.w   pass
+    0x1C3C, 0x0077,                         // move.b  #$77, D6
+    0x6100, 0x0004,                         // bsr.w   pass
+    0x60EE,                                 // bra.s   loop
+
+    0x7E4E,                                 // pass: moveq #78, D7
+    0x6100, 0x0012,                         // next: bsr.w read
+    0x1A86,                                 // move.b  D6, (A5)
+    0x5306,                                 // subq.b  #1, D6
+    0x1A86,                                 // move.b  D6, (A5)
+    0x5206,                                 // addq.b  #1, D6
+    0x1A86,                                 // move.b  D6, (A5)
+    0x51CF, 0xFFF0,                         // dbra    D7, next
+    0x4E75,                                 // rts
+
+    0x2D7C, 0x0003, 0x0000, 0x0020,         // read: move.l #$30000, DSKPT(A6)
+    0x3D7C, 0x4000, 0x0024,                 // move.w  #$4000, DSKLEN(A6)
+    0x3D7C, 0x989C, 0x0024,                 // move.w  #$989c, DSKLEN(A6)
+    0x3D7C, 0x989C, 0x0024,                 // move.w  #$989c, DSKLEN(A6)
+    0x082E, 0x0001, 0x001F,                 // wait: btst #1, INTREQR+1(A6)
+    0x67F8,                                 // beq.s   wait
+    0x3D7C, 0x0002, 0x009C,                 // move.w  #$2, INTREQ(A6)
+    0x4E75                                  // rts
+};
+
+// Plays the waveform at $38000 on all four audio channels
+static const u16 benchAudioProgram[] = {
+
+    0x2D7C, 0x0003, 0x8000, 0x00A0,         // move.l  #$38000, AUD0LC(A6)
+    0x3D7C, 0x0080, 0x00A4,                 // move.w  #128, AUD0LEN(A6)
+    0x3D7C, 0x007C, 0x00A6,                 // move.w  #124, AUD0PER(A6)
+    0x3D7C, 0x0040, 0x00A8,                 // move.w  #64, AUD0VOL(A6)
+    0x2D7C, 0x0003, 0x8000, 0x00B0,         // move.l  #$38000, AUD1LC(A6)
+    0x3D7C, 0x0080, 0x00B4,                 // move.w  #128, AUD1LEN(A6)
+    0x3D7C, 0x00A0, 0x00B6,                 // move.w  #160, AUD1PER(A6)
+    0x3D7C, 0x0040, 0x00B8,                 // move.w  #64, AUD1VOL(A6)
+    0x2D7C, 0x0003, 0x8000, 0x00C0,         // move.l  #$38000, AUD2LC(A6)
+    0x3D7C, 0x0080, 0x00C4,                 // move.w  #128, AUD2LEN(A6)
+    0x3D7C, 0x00C8, 0x00C6,                 // move.w  #200, AUD2PER(A6)
+    0x3D7C, 0x0040, 0x00C8,                 // move.w  #64, AUD2VOL(A6)
+    0x2D7C, 0x0003, 0x8000, 0x00D0,         // move.l  #$38000, AUD3LC(A6)
+    0x3D7C, 0x0080, 0x00D4,                 // move.w  #128, AUD3LEN(A6)
+    0x3D7C, 0x00FE, 0x00D6,                 // move.w  #254, AUD3PER(A6)
+    0x3D7C, 0x0040, 0x00D8,                 // move.w  #64, AUD3VOL(A6)
+    0x3D7C, 0x820F, 0x0096,                 // move.w  #$820f, DMACON(A6)
+    0x60FE                                  // bra.s   *
+};
+
+// Integer arithmetic, logic, and shift instructions
+static const u16 benchAluProgram[] = {
+
+    0xD280,                                 // loop: add.l D0, D1
+    0x9681,                                 // sub.l   D1, D3
+    0xC883,                                 // and.l   D3, D4
+    0x8A84,                                 // or.l    D4, D5
+    0xB186,                                 // eor.l   D0, D6
+    0xE78A,                                 // lsl.l   #3, D2
+    0xE29F,                                 // ror.l   #1, D7
+    0x5280,                                 // addq.l  #1, D0
+    0x4483,                                 // neg.l   D3
+    0xC141,                                 // exg     D0, D1
+    0x60EA                                  // bra.s   loop
+};
+
+// Multiplication and division
+static const u16 benchMulDivProgram[] = {
+
+    0x7407,                                 // moveq   #7, D2
+    0xC0C2,                                 // loop: mulu.w D2, D0
+    0xC3C2,                                 // muls.w  D2, D1
+    0x80C2,                                 // divu.w  D2, D0
+    0x83C2,                                 // divs.w  D2, D1
+    0x5280,                                 // addq.l  #1, D0
+    0x60F4                                  // bra.s   loop
+};
+
+// Memory accesses with various addressing modes
+static const u16 benchMemoryProgram[] = {
+
+    0x41F9, 0x0001, 0x0000,                 // loop: lea $10000, A0
+    0x43F9, 0x0002, 0x0000,                 // lea     $20000, A1
+    0x303C, 0x00FF,                         // move.w  #255, D0
+    0x22D8,                                 // copy: move.l (A0)+, (A1)+
+    0x2428, 0x0010,                         // move.l  16(A0), D2
+    0x2342, 0x0020,                         // move.l  D2, 32(A1)
+    0x51C8, 0xFFF4,                         // dbra    D0, copy
+    0x60E0                                  // bra.s   loop
+};
+
+// Subroutine calls and conditional branches
+static const u16 benchBranchProgram[] = {
+
+    0x610E,                                 // loop: bsr.s sub
+    0x7203,                                 // moveq   #3, D1
+    0x51C9, 0xFFFE,                         // wait: dbra D1, wait
+    0xB081,                                 // cmp.l   D1, D0
+    0x6702,                                 // beq.s   skip
+    0x5280,                                 // addq.l  #1, D0
+    0x60F0,                                 // skip: bra.s loop
+    0x4E71,                                 // sub: nop
+    0x4E75                                  // rts
+};
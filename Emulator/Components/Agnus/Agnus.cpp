@@ -48,6 +48,7 @@ Agnus::operator << (SerResetter &worker)
         id[i] = (EventID)0;
         data[i] = 0;
     }
+    pending = 0;
 
     // Schedule initial events
     if (isHardResetter(worker)) assert(clock == 0);
@@ -63,6 +64,13 @@ Agnus::operator << (SerResetter &worker)
     if (insEvent) scheduleRel <SLOT_INS> (0, insEvent);
 }
 
+void
+Agnus::_didLoad()
+{
+    // The pending mask is not part of the snapshot
+    updatePending();
+}
+
 i64
 Agnus::getOption(Option option) const
 {
@@ -224,7 +232,17 @@ Agnus::execute()
 void
 Agnus::execute(DMACycle cycles)
 {
-    for (DMACycle i = 0; i < cycles; i++) execute();
+    while (cycles > 0) {
+
+        // Advance in a single step up to the next trigger cycle
+        auto chunk = std::min(cycles, cyclesUntilNextTrigger());
+        clock += DMA_CYCLES(chunk);
+        pos.h += chunk;
+        cycles -= chunk;
+
+        // Process pending events
+        if (nextTrigger <= clock) executeUntil(clock);
+    }
 }
 
 void
@@ -318,6 +336,15 @@ Agnus::executeUntilBusIsFreeForCIA()
     syncWithEClock();
 }
 
+void
+Agnus::updatePending()
+{
+    pending = 0;
+    for (isize i = 0; i < SLOT_COUNT; i++) {
+        if (trigger[i] != NEVER) pending |= u64(1) << i;
+    }
+}
+
 void
 Agnus::recordRegisterChange(Cycle delay, u32 addr, u16 value, Accessor acc)
 {
@@ -331,157 +358,145 @@ Agnus::recordRegisterChange(Cycle delay, u32 addr, u16 value, Accessor acc)
 void
 Agnus::executeUntil(Cycle cycle) {
 
+    /* Only slots with a pending event are visited. They are served in
+     * ascending slot order. Because an event handler may schedule or cancel
+     * events in other slots, the next slot is looked up in the pending mask,
+     * which is kept up to date by the scheduling functions. Slots that have
+     * already been served are masked out, so the behavior matches a linear
+     * scan over all slots.
+     */
+    stats.executeCalls++;
+
     //
     // Check primary slots
     //
 
-    if (isDue<SLOT_REG>(cycle)) {
-        agnus.serviceREGEvent(cycle);
-    }
-    if (isDue<SLOT_CIAA>(cycle)) {
-        ciaa.serviceEvent(id[SLOT_CIAA]);
-    }
-    if (isDue<SLOT_CIAB>(cycle)) {
-        ciab.serviceEvent(id[SLOT_CIAB]);
-    }
-    if (isDue<SLOT_BPL>(cycle)) {
-        agnus.serviceBPLEvent(id[SLOT_BPL]);
-    }
-    if (isDue<SLOT_DAS>(cycle)) {
-        agnus.serviceDASEvent(id[SLOT_DAS]);
-    }
-    if (isDue<SLOT_COP>(cycle)) {
-        copper.serviceEvent(id[SLOT_COP]);
-    }
-    if (isDue<SLOT_BLT>(cycle)) {
-        blitter.serviceEvent(id[SLOT_BLT]);
-    }
+    for (u64 due = pendingSlots<SLOT_REG, SLOT_SEC>(); due; ) {
 
-    if (isDue<SLOT_SEC>(cycle)) {
+        auto slot = std::countr_zero(due);
+        stats.slotsVisited++;
 
-        //
-        // Check secondary slots
-        //
+        // Skip the slot if its event isn't due yet
+        if (cycle < trigger[slot]) { due &= due - 1; continue; }
 
-        if (isDue<SLOT_CH0>(cycle)) {
-            paula.channel0.serviceEvent();
-        }
-        if (isDue<SLOT_CH1>(cycle)) {
-            paula.channel1.serviceEvent();
-        }
-        if (isDue<SLOT_CH2>(cycle)) {
-            paula.channel2.serviceEvent();
-        }
-        if (isDue<SLOT_CH3>(cycle)) {
-            paula.channel3.serviceEvent();
-        }
-        if (isDue<SLOT_DSK>(cycle)) {
-            paula.diskController.serviceDiskEvent();
-        }
-        if (isDue<SLOT_VBL>(cycle)) {
-            agnus.serviceVBLEvent(id[SLOT_VBL]);
-        }
-        if (isDue<SLOT_IRQ>(cycle)) {
-            paula.serviceIrqEvent();
-        }
-        if (isDue<SLOT_KBD>(cycle)) {
-            keyboard.serviceKeyboardEvent(id[SLOT_KBD]);
-        }
-        if (isDue<SLOT_TXD>(cycle)) {
-            uart.serviceTxdEvent(id[SLOT_TXD]);
-        }
-        if (isDue<SLOT_RXD>(cycle)) {
-            uart.serviceRxdEvent(id[SLOT_RXD]);
-        }
-        if (isDue<SLOT_POT>(cycle)) {
-            paula.servicePotEvent(id[SLOT_POT]);
-        }
-        if (isDue<SLOT_IPL>(cycle)) {
-            paula.serviceIplEvent();
-        }
-        if (isDue<SLOT_TER>(cycle)) {
+        amiga.profiler.enter(slot);
 
-            //
-            // Check tertiary slots
-            //
+        switch (EventSlot(slot)) {
 
-            if (isDue<SLOT_DC0>(cycle)) {
-                df0.serviceDiskChangeEvent <SLOT_DC0> ();
-            }
-            if (isDue<SLOT_DC1>(cycle)) {
-                df1.serviceDiskChangeEvent <SLOT_DC1> ();
-            }
-            if (isDue<SLOT_DC2>(cycle)) {
-                df2.serviceDiskChangeEvent <SLOT_DC2> ();
-            }
-            if (isDue<SLOT_DC3>(cycle)) {
-                df3.serviceDiskChangeEvent <SLOT_DC3> ();
-            }
-            if (isDue<SLOT_HD0>(cycle)) {
-                hd0.serviceHdrEvent <SLOT_HD0> ();
-            }
-            if (isDue<SLOT_HD1>(cycle)) {
-                hd1.serviceHdrEvent <SLOT_HD1> ();
-            }
-            if (isDue<SLOT_HD2>(cycle)) {
-                hd2.serviceHdrEvent <SLOT_HD2> ();
-            }
-            if (isDue<SLOT_HD3>(cycle)) {
-                hd3.serviceHdrEvent <SLOT_HD3> ();
-            }
-            if (isDue<SLOT_MSE1>(cycle)) {
-                controlPort1.mouse.serviceMouseEvent <SLOT_MSE1> ();
-            }
-            if (isDue<SLOT_MSE2>(cycle)) {
-                controlPort2.mouse.serviceMouseEvent <SLOT_MSE2> ();
-            }
-            if (isDue<SLOT_SNP>(cycle)) {
-                amiga.serviceSnpEvent(id[SLOT_KEY]);
-            }
-            if (isDue<SLOT_RSH>(cycle)) {
-                retroShell.serviceEvent();
-            }
-            if (isDue<SLOT_KEY>(cycle)) {
-                keyboard.serviceKeyEvent();
-            }
-            if (isDue<SLOT_SRV>(cycle)) {
-                remoteManager.serviceServerEvent();
-            }
-            if (isDue<SLOT_SER>(cycle)) {
-                remoteManager.serServer.serviceSerEvent();
-            }
-            if (isDue<SLOT_BTR>(cycle)) {
-                dmaDebugger.beamtraps.serviceEvent();
-            }
-            if (isDue<SLOT_ALA>(cycle)) {
-                amiga.serviceAlarmEvent();
-            }
-            if (isDue<SLOT_INS>(cycle)) {
-                agnus.serviceINSEvent();
-            }
+            case SLOT_REG:  agnus.serviceREGEvent(cycle); break;
+            case SLOT_CIAA: ciaa.serviceEvent(id[SLOT_CIAA]); break;
+            case SLOT_CIAB: ciab.serviceEvent(id[SLOT_CIAB]); break;
+            case SLOT_BPL:  agnus.serviceBPLEvent(id[SLOT_BPL]); break;
+            case SLOT_DAS:  agnus.serviceDASEvent(id[SLOT_DAS]); break;
+            case SLOT_COP:  copper.serviceEvent(id[SLOT_COP]); break;
+            case SLOT_BLT:  blitter.serviceEvent(id[SLOT_BLT]); break;
 
-            // Determine the next trigger cycle for all tertiary slots
-            Cycle next = trigger[SLOT_TER + 1];
-            for (isize i = SLOT_TER + 2; i < SLOT_COUNT; i++) {
-                if (trigger[i] < next) next = trigger[i];
-            }
-            rescheduleAbs<SLOT_TER>(next);
+            default:
+                executeSecondaryUntil(cycle);
+                break;
         }
-        
-        // Determine the next trigger cycle for all secondary slots
-        Cycle next = trigger[SLOT_SEC + 1];
-        for (isize i = SLOT_SEC + 2; i <= SLOT_TER; i++) {
-            if (trigger[i] < next) next = trigger[i];
-        }
-        rescheduleAbs<SLOT_SEC>(next);
+
+        amiga.profiler.leave();
+        due = pendingSlots<SLOT_REG, SLOT_SEC>() & (~u64(0) << (slot + 1));
     }
 
     // Determine the next trigger cycle for all primary slots
-    Cycle next = trigger[0];
-    for (isize i = 1; i <= SLOT_SEC; i++) {
-        if (trigger[i] < next) next = trigger[i];
+    nextTrigger = nextTriggerOf<SLOT_REG, SLOT_SEC>();
+}
+
+void
+Agnus::executeSecondaryUntil(Cycle cycle) {
+
+    //
+    // Check secondary slots
+    //
+
+    for (u64 due = pendingSlots<SLOT_CH0, SLOT_TER>(); due; ) {
+
+        auto slot = std::countr_zero(due);
+        stats.slotsVisited++;
+
+        // Skip the slot if its event isn't due yet
+        if (cycle < trigger[slot]) { due &= due - 1; continue; }
+
+        amiga.profiler.enter(slot);
+
+        switch (EventSlot(slot)) {
+
+            case SLOT_CH0:  paula.channel0.serviceEvent(); break;
+            case SLOT_CH1:  paula.channel1.serviceEvent(); break;
+            case SLOT_CH2:  paula.channel2.serviceEvent(); break;
+            case SLOT_CH3:  paula.channel3.serviceEvent(); break;
+            case SLOT_DSK:  paula.diskController.serviceDiskEvent(); break;
+            case SLOT_VBL:  agnus.serviceVBLEvent(id[SLOT_VBL]); break;
+            case SLOT_IRQ:  paula.serviceIrqEvent(); break;
+            case SLOT_IPL:  paula.serviceIplEvent(); break;
+            case SLOT_KBD:  keyboard.serviceKeyboardEvent(id[SLOT_KBD]); break;
+            case SLOT_TXD:  uart.serviceTxdEvent(id[SLOT_TXD]); break;
+            case SLOT_RXD:  uart.serviceRxdEvent(id[SLOT_RXD]); break;
+            case SLOT_POT:  paula.servicePotEvent(id[SLOT_POT]); break;
+
+            default:
+                executeTertiaryUntil(cycle);
+                break;
+        }
+
+        amiga.profiler.leave();
+        due = pendingSlots<SLOT_CH0, SLOT_TER>() & (~u64(0) << (slot + 1));
+    }
+
+    // Determine the next trigger cycle for all secondary slots
+    rescheduleAbs<SLOT_SEC>(nextTriggerOf<SLOT_CH0, SLOT_TER>());
+}
+
+void
+Agnus::executeTertiaryUntil(Cycle cycle) {
+
+    //
+    // Check tertiary slots
+    //
+
+    for (u64 due = pendingSlots<SLOT_DC0, SLOT_INS>(); due; ) {
+
+        auto slot = std::countr_zero(due);
+        stats.slotsVisited++;
+
+        // Skip the slot if its event isn't due yet
+        if (cycle < trigger[slot]) { due &= due - 1; continue; }
+
+        amiga.profiler.enter(slot);
+
+        switch (EventSlot(slot)) {
+
+            case SLOT_DC0:  df0.serviceDiskChangeEvent <SLOT_DC0> (); break;
+            case SLOT_DC1:  df1.serviceDiskChangeEvent <SLOT_DC1> (); break;
+            case SLOT_DC2:  df2.serviceDiskChangeEvent <SLOT_DC2> (); break;
+            case SLOT_DC3:  df3.serviceDiskChangeEvent <SLOT_DC3> (); break;
+            case SLOT_HD0:  hd0.serviceHdrEvent <SLOT_HD0> (); break;
+            case SLOT_HD1:  hd1.serviceHdrEvent <SLOT_HD1> (); break;
+            case SLOT_HD2:  hd2.serviceHdrEvent <SLOT_HD2> (); break;
+            case SLOT_HD3:  hd3.serviceHdrEvent <SLOT_HD3> (); break;
+            case SLOT_MSE1: controlPort1.mouse.serviceMouseEvent <SLOT_MSE1> (); break;
+            case SLOT_MSE2: controlPort2.mouse.serviceMouseEvent <SLOT_MSE2> (); break;
+            case SLOT_SNP:  amiga.serviceSnpEvent(id[SLOT_KEY]); break;
+            case SLOT_RSH:  retroShell.serviceEvent(); break;
+            case SLOT_KEY:  keyboard.serviceKeyEvent(); break;
+            case SLOT_SRV:  remoteManager.serviceServerEvent(); break;
+            case SLOT_SER:  remoteManager.serServer.serviceSerEvent(); break;
+            case SLOT_BTR:  dmaDebugger.beamtraps.serviceEvent(); break;
+            case SLOT_ALA:  amiga.serviceAlarmEvent(); break;
+            case SLOT_INS:  agnus.serviceINSEvent(); break;
+
+            default:
+                fatalError;
+        }
+
+        amiga.profiler.leave();
+        due = pendingSlots<SLOT_DC0, SLOT_INS>() & (~u64(0) << (slot + 1));
     }
-    nextTrigger = next;
+
+    // Determine the next trigger cycle for all tertiary slots
+    rescheduleAbs<SLOT_TER>(nextTriggerOf<SLOT_DC0, SLOT_INS>());
 }
 
 template <isize nr> void
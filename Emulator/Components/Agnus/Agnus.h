@@ -81,6 +81,9 @@ public:
     
     // Next trigger cycle
     Cycle nextTrigger = NEVER;
+
+    // Slots with a pending event (bit n is set iff trigger[n] != NEVER)
+    u64 pending = 0;
     
     // Pending register changes
     RegChangeRecorder<8> changeRecorder;
@@ -225,6 +228,7 @@ public:
         CLONE_ARRAY(id)
         CLONE_ARRAY(data)
         CLONE(nextTrigger)
+        CLONE(pending)
         CLONE(changeRecorder)
         CLONE(syncEvent)
 
@@ -352,6 +356,7 @@ public:
 private:
     
     void _dump(Category category, std::ostream& os) const override;
+    void _didLoad() override;
 
     
     //
@@ -454,6 +459,12 @@ public:
 
     // Executes Agnus for a certain amount of cycles
     void execute(DMACycle cycles);
+
+    // Returns the number of DMA cycles until the next event triggers
+    DMACycle cyclesUntilNextTrigger() const {
+        auto delta = nextTrigger - clock;
+        return delta <= DMA_CYCLES(1) ? 1 : (delta - 1) / DMA_CYCLES(1) + 1;
+    }
     
     // Executes Agnus to the beginning of the next E clock cycle
     void syncWithEClock();
@@ -470,6 +481,10 @@ private:
     // Processes all events up to a given master cycle
     void executeUntil(Cycle cycle);
 
+    // Processes the secondary and tertiary slots (called by executeUntil)
+    void executeSecondaryUntil(Cycle cycle);
+    void executeTertiaryUntil(Cycle cycle);
+
     // Executes the first sprite DMA cycle
     template <isize nr> void executeFirstSpriteCycle();
 
@@ -658,27 +673,63 @@ public:
     
     // Returns true iff the specified slot contains a due event
     template<EventSlot s> bool isDue(Cycle cycle) const { return cycle >= this->trigger[s]; }
+
+    // Returns a bit mask with a bit set for each pending slot in [s1;s2]
+    template<EventSlot s1, EventSlot s2> u64 pendingSlots() const {
+
+        static_assert(s1 <= s2 && SLOT_COUNT <= 64);
+
+        constexpr u64 mask = (~u64(0) >> (63 - s2)) & (~u64(0) << s1);
+        return pending & mask;
+    }
+
+    // Returns the earliest trigger cycle of all slots in [s1;s2]
+    template<EventSlot s1, EventSlot s2> Cycle nextTriggerOf() const {
+
+        Cycle result = NEVER;
+        for (u64 mask = pendingSlots<s1, s2>(); mask; mask &= mask - 1) {
+            result = std::min(result, trigger[std::countr_zero(mask)]);
+        }
+        return result;
+    }
+
+    // Recomputes the pending mask from the trigger cycles
+    void updatePending();
     
     
     //
     // Scheduling events
     //
     
+private:
+
+    // Sets the trigger cycle of a slot and updates the pending mask
+    template<EventSlot s> void setTrigger(Cycle cycle)
+    {
+        trigger[s] = cycle;
+
+        if (cycle != NEVER) {
+            pending |= u64(1) << s;
+        } else {
+            pending &= ~(u64(1) << s);
+        }
+    }
+
 public:
     
     template<EventSlot s> void scheduleAbs(Cycle cycle, EventID id)
     {
-        this->trigger[s] = cycle;
+        setTrigger<s>(cycle);
         this->id[s] = id;
         
         if (cycle < nextTrigger) nextTrigger = cycle;
         
         if constexpr (isTertiarySlot(s)) {
-            if (cycle < trigger[SLOT_TER]) trigger[SLOT_TER] = cycle;
-            if (cycle < trigger[SLOT_SEC]) trigger[SLOT_SEC] = cycle;
+            if (cycle < trigger[SLOT_TER]) setTrigger<SLOT_TER>(cycle);
+            if (cycle < trigger[SLOT_SEC]) setTrigger<SLOT_SEC>(cycle);
         }
         if constexpr (isSecondarySlot(s)) {
-            if (cycle < trigger[SLOT_SEC]) trigger[SLOT_SEC] = cycle;
+            if (cycle < trigger[SLOT_SEC]) setTrigger<SLOT_SEC>(cycle);
         }
     }
     
@@ -712,14 +763,14 @@ public:
 
     template<EventSlot s> void rescheduleAbs(Cycle cycle)
     {
-        trigger[s] = cycle;
+        setTrigger<s>(cycle);
         if (cycle < nextTrigger) nextTrigger = cycle;
         
         if constexpr (isTertiarySlot(s)) {
-            if (cycle < trigger[SLOT_TER]) trigger[SLOT_TER] = cycle;
+            if (cycle < trigger[SLOT_TER]) setTrigger<SLOT_TER>(cycle);
         }
         if constexpr (isSecondarySlot(s) || isTertiarySlot(s)) {
-            if (cycle < trigger[SLOT_SEC]) trigger[SLOT_SEC] = cycle;
+            if (cycle < trigger[SLOT_SEC]) setTrigger<SLOT_SEC>(cycle);
         }
     }
     
@@ -761,7 +812,7 @@ public:
     {
         id[s] = (EventID)0;
         data[s] = 0;
-        trigger[s] = NEVER;
+        setTrigger<s>(NEVER);
     }
 
     
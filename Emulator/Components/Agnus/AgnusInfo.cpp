@@ -718,6 +718,19 @@ Agnus::updateStats()
     stats.bitplaneActivity = w * stats.bitplaneActivity + (1 - w) * bitplaneUsage;
     
     for (isize i = 0; i < BUS_COUNT; i++) stats.usage[i] = 0;
+
+    if (stats.executeCalls) {
+
+        double slotsPerCall = double(stats.slotsVisited) / double(stats.executeCalls);
+        stats.slotsPerCall = w * stats.slotsPerCall + (1 - w) * slotsPerCall;
+    }
+    stats.executeCalls = 0;
+    stats.slotsVisited = 0;
+
+    stats.bplCacheHits = sequencer.bplCacheHits;
+    stats.bplCacheMisses = sequencer.bplCacheMisses;
+    sequencer.bplCacheHits = 0;
+    sequencer.bplCacheMisses = 0;
 }
 
 }
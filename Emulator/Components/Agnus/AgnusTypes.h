@@ -545,5 +545,14 @@ typedef struct
     double audioActivity;
     double spriteActivity;
     double bitplaneActivity;
+
+    // Event scheduler
+    isize executeCalls;
+    isize slotsVisited;
+    double slotsPerCall;
+
+    // Bitplane event table cache
+    isize bplCacheHits;
+    isize bplCacheMisses;
 }
 AgnusStats;
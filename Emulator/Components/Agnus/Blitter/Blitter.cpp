@@ -546,10 +546,10 @@ Blitter::beginBlit()
 void
 Blitter::beginLineBlit(isize level)
 {
-    static u64 verbose = 0;
+    if (BLT_CHECKSUM) {
 
-    if (verbose++ == 0) {
-        debug(BLT_CHECKSUM, "Performing level %ld line blits.\n", level);
+        static std::atomic<u64> verbose = 0;
+        if (verbose++ == 0) debug(BLT_CHECKSUM, "Performing level %ld line blits.\n", level);
     }
     if (bltcon0 & BLTCON0_USEB) {
         xfiles("Performing line blit with channel B enabled\n");
@@ -572,10 +572,10 @@ Blitter::beginLineBlit(isize level)
 void
 Blitter::beginCopyBlit(isize level)
 {
-    static u64 verbose = 0;
+    if (BLT_CHECKSUM) {
 
-    if (verbose++ == 0) {
-        debug(BLT_CHECKSUM, "Performing level %ld copy blits.\n", level);
+        static std::atomic<u64> verbose = 0;
+        if (verbose++ == 0) debug(BLT_CHECKSUM, "Performing level %ld copy blits.\n", level);
     }
 
     switch (level) {
@@ -526,6 +526,13 @@ private:
     // Performs a copy blit operation via the FastBlitter
     template <bool useA, bool useB, bool useC, bool useD, bool desc>
     void doFastCopyBlit();
+
+    // Checks if a channel stays inside Chip Ram during the entire blit
+    bool isChipRamChannel(u32 pt, i16 mod, bool desc) const;
+
+    // Performs a copy blit operation row by row directly on Chip Ram
+    template <bool useA, bool useB, bool useC, bool useD, bool desc>
+    void doFastCopyBlitRows();
     
     // Performs a line blit operation via the FastBlitter
     void doFastLineBlit();
@@ -13,9 +13,49 @@
 #include "Checksum.h"
 #include "Memory.h"
 #include "Paula.h"
+#include <array>
+#include <utility>
 
 namespace vamiga {
 
+namespace {
+
+// Computes a single word of the minterm circuit with a fixed minterm
+template <int m> inline u16 minterm(u16 a, u16 b, u16 c)
+{
+    u16 result = 0;
+
+    if constexpr (bool(m & 0b10000000)) result |=  a &  b &  c;
+    if constexpr (bool(m & 0b01000000)) result |=  a &  b & ~c;
+    if constexpr (bool(m & 0b00100000)) result |=  a & ~b &  c;
+    if constexpr (bool(m & 0b00010000)) result |=  a & ~b & ~c;
+    if constexpr (bool(m & 0b00001000)) result |= ~a &  b &  c;
+    if constexpr (bool(m & 0b00000100)) result |= ~a &  b & ~c;
+    if constexpr (bool(m & 0b00000010)) result |= ~a & ~b &  c;
+    if constexpr (bool(m & 0b00000001)) result |= ~a & ~b & ~c;
+
+    return result;
+}
+
+// Runs the minterm circuit on an entire row segment
+template <int m> void mintermKernel(const u16 *a, const u16 *b, const u16 *c, u16 *d, isize n)
+{
+    for (isize i = 0; i < n; i++) d[i] = minterm<m>(a[i], b[i], c[i]);
+}
+
+typedef void (*MintermKernel)(const u16 *, const u16 *, const u16 *, u16 *, isize);
+
+template <std::size_t... m> constexpr auto
+makeMintermKernels(std::index_sequence<m...>)
+{
+    return std::array<MintermKernel, sizeof...(m)> { &mintermKernel<int(m)>... };
+}
+
+// One specialized kernel for each of the 256 minterms
+constexpr auto mintermKernels = makeMintermKernels(std::make_index_sequence<256>());
+
+}
+
 void
 Blitter::initFastBlitter()
 {
@@ -76,6 +116,17 @@ Blitter::beginFastLineBlit()
 template <bool useA, bool useB, bool useC, bool useD, bool desc>
 void Blitter::doFastCopyBlit()
 {
+    // Use the row engine if all channels stay inside Chip Ram
+    if (!BLT_DEBUG && !BLT_CHECKSUM &&
+        (!useA || isChipRamChannel(bltapt, bltamod, desc)) &&
+        (!useB || isChipRamChannel(bltbpt, bltbmod, desc)) &&
+        (!useC || isChipRamChannel(bltcpt, bltcmod, desc)) &&
+        (!useD || isChipRamChannel(bltdpt, bltdmod, desc))) {
+
+        doFastCopyBlitRows<useA, useB, useC, useD, desc>();
+        return;
+    }
+
     u32 apt = bltapt;
     u32 bpt = bltbpt;
     u32 cpt = bltcpt;
@@ -177,6 +228,168 @@ void Blitter::doFastCopyBlit()
     bltdpt = dpt;
 }
 
+bool
+Blitter::isChipRamChannel(u32 pt, i16 mod, bool desc) const
+{
+    i64 limit = std::min(i64(mem.chipRamSize()), i64(agnus.ptrMask) + 1);
+    i64 incr = desc ? -2 : 2;
+    i64 span = incr * (bltsizeH - 1);
+    i64 stride = incr * bltsizeH + (desc ? -mod : mod);
+
+    // The pointer moves linearly, so the extreme values are reached in the first or last row
+    i64 first = pt;
+    i64 last = first + (bltsizeV - 1) * stride;
+    i64 lo = std::min(first, last) + std::min(span, i64(0));
+    i64 hi = std::max(first, last) + std::max(span, i64(0));
+
+    return lo >= 0 && hi + 2 <= limit;
+}
+
+template <bool useA, bool useB, bool useC, bool useD, bool desc>
+void Blitter::doFastCopyBlitRows()
+{
+    /* This function produces the same results as the word-based code path,
+     * but processes all words of a row segment in a single sweep. Each channel
+     * is fetched into a local buffer, and the barrel shifters, the minterm
+     * circuit, and the fill logic are applied to the whole buffer before D is
+     * written back. Chip Ram is accessed directly, which is possible because
+     * the caller has verified that no channel leaves Chip Ram.
+     */
+    constexpr isize incr = desc ? -2 : 2;
+    constexpr isize maxWidth = 0x800;
+
+    const isize width = bltsizeH;
+    const isize amod = desc ? -bltamod : bltamod;
+    const isize bmod = desc ? -bltbmod : bltbmod;
+    const isize cmod = desc ? -bltcmod : bltcmod;
+    const isize dmod = desc ? -bltdmod : bltdmod;
+    const auto ash = bltconASH();
+    const auto bsh = bltconBSH();
+    const auto kernel = mintermKernels[bltcon0 & 0xFF];
+    const bool fill = bltconFE();
+
+    u8 *chip = mem.chip;
+    isize apt = bltapt;
+    isize bpt = bltbpt;
+    isize cpt = bltcpt;
+    isize dpt = bltdpt;
+
+    // The first element of 'a' and 'b' holds the last word of the previous segment
+    u16 a[maxWidth + 1], b[maxWidth + 1], c[maxWidth], d[maxWidth];
+    u16 ah[maxWidth], bh[maxWidth];
+    u16 zero = 0;
+
+    assert(width <= maxWidth);
+
+    auto shift = [&](u16 cur, u16 prev, u16 sh) {
+        return desc ? u16(HI_W_LO_W(cur, prev) >> (16 - sh)) : u16(HI_W_LO_W(prev, cur) >> sh);
+    };
+
+    aold = 0;
+    bold = 0;
+
+    for (isize y = 0; y < bltsizeV; y++) {
+
+        // Reset the fill carry bit
+        bool carry = !!bltconFCI();
+
+        /* If D writes ahead of a source channel, the written words must not be
+         * fetched before they have been written. In this case, the row is split
+         * into segments that are small enough to keep the original order.
+         */
+        isize chunk = width;
+        auto limit = [&](isize spt) {
+            auto ahead = desc ? spt - dpt : dpt - spt;
+            if (ahead > 0 && ahead < 2 * width) chunk = std::min(chunk, ahead / 2);
+        };
+        if (useD && useA) limit(apt);
+        if (useD && useB) limit(bpt);
+        if (useD && useC) limit(cpt);
+
+        for (isize x = 0; x < width; x += chunk) {
+
+            isize n = std::min(chunk, width - x);
+
+            // Fetch A and run the barrel shifter (even if channel A is disabled)
+            for (isize i = 1; i <= n; i++) {
+
+                if (useA) { a[i] = R16BE(chip + apt); apt += incr; } else { a[i] = anew; }
+            }
+            if (useA) anew = a[n];
+            if (x == 0) a[1] &= bltafwm;
+            if (x + n == width) a[n] &= bltalwm;
+
+            a[0] = aold;
+            for (isize i = 0; i < n; i++) ah[i] = shift(a[i + 1], a[i], ash);
+            aold = a[n];
+
+            // Fetch B and run the barrel shifter (if channel B is enabled)
+            if (useB) {
+
+                for (isize i = 1; i <= n; i++) { b[i] = R16BE(chip + bpt); bpt += incr; }
+                bnew = b[n];
+
+                b[0] = bold;
+                for (isize i = 0; i < n; i++) bh[i] = shift(b[i + 1], b[i], bsh);
+                bold = b[n];
+
+            } else {
+
+                for (isize i = 0; i < n; i++) bh[i] = bhold;
+            }
+
+            // Fetch C
+            if (useC) {
+
+                for (isize i = 0; i < n; i++) { c[i] = R16BE(chip + cpt); cpt += incr; }
+                chold = c[n - 1];
+
+            } else {
+
+                for (isize i = 0; i < n; i++) c[i] = chold;
+            }
+
+            // Run the minterm circuit
+            kernel(ah, bh, c, d, n);
+
+            // Run the fill logic circuit
+            if (fill) for (isize i = 0; i < n; i++) doFill(d[i], carry);
+
+            // Update the zero flag
+            for (isize i = 0; i < n; i++) zero |= d[i];
+
+            // Write D
+            if (useD) {
+                for (isize i = 0; i < n; i++) { W16BE(chip + dpt, d[i]); dpt += incr; }
+            }
+
+            ahold = ah[n - 1];
+            bhold = bh[n - 1];
+            dhold = d[n - 1];
+        }
+
+        // Add modulo values
+        if (useA) apt += amod;
+        if (useB) bpt += bmod;
+        if (useC) cpt += cmod;
+        if (useD) dpt += dmod;
+    }
+
+    if (zero) bzero = false;
+
+    // Leave the last transferred word on the data bus
+    if (useD) mem.dataBus = dhold;
+    else if (useC) mem.dataBus = chold;
+    else if (useB) mem.dataBus = bnew;
+    else if (useA) mem.dataBus = anew;
+
+    // Write back pointer registers
+    bltapt = u32(apt);
+    bltbpt = u32(bpt);
+    bltcpt = u32(cpt);
+    bltdpt = u32(dpt);
+}
+
 void
 Blitter::doFastLineBlit()
 {
@@ -332,7 +332,7 @@ void
 DmaDebugger::eolHandler()
 {
     // Only proceed if DMA debugging has been turned on
-    if (!config.enabled) return;
+    if (!config.enabled || amiga.isHeadless()) return;
 
     // Copy Agnus arrays before they get deleted
     std::memcpy(busValue, agnus.busValue, sizeof(agnus.busValue));
@@ -348,7 +348,7 @@ DmaDebugger::hsyncHandler(isize vpos)
     assert(agnus.pos.h == 0x12);
 
     // Only proceed if DMA debugging has been turned on
-    if (!config.enabled) return;
+    if (!config.enabled || amiga.isHeadless()) return;
 
     // Draw first chunk (data from previous DMA line)
     auto *ptr1 = pixelEngine.workingPtr(vpos);
@@ -434,7 +434,7 @@ void
 DmaDebugger::vSyncHandler()
 {
     // Only proceed if the debugger is enabled
-    if (!config.enabled) return;
+    if (!config.enabled || amiga.isHeadless()) return;
 
     // Clear old data in the VBLANK area of the next frame
     for (isize row = 0; row < VBLANK_CNT; row++) {
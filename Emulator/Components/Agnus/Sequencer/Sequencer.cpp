@@ -18,12 +18,6 @@ Sequencer::Sequencer(Amiga& ref) : SubComponent(ref)
 
 }
 
-void
-Sequencer::_initialize()
-{
-    initDasEventTable();
-}
-
 void
 Sequencer::operator << (SerResetter &worker)
 {
@@ -31,6 +25,9 @@ Sequencer::operator << (SerResetter &worker)
 
     initBplEvents();
     initDasEvents();
+
+    // Make sure the recorder is terminated before the first line ends
+    initSigRecorder();
 }
 
 void
@@ -14,6 +14,7 @@
 #include "ChangeRecorder.h"
 #include "SubComponent.h"
 #include "MemoryTypes.h"
+#include <array>
 
 namespace vamiga {
 
@@ -115,6 +116,41 @@ static constexpr usize UPDATE_SIG_RECORDER  = 0b001;
 static constexpr usize UPDATE_BPL_TABLE     = 0b010;
 static constexpr usize UPDATE_DAS_TABLE     = 0b100;
 
+/* Many programs modify DDFSTRT, DDFSTOP, BPLCON0, or DMACON in the middle of
+ * a scanline, usually in a pattern that repeats every line or every frame. In
+ * this case, the same bitplane event table is computed over and over again.
+ * To speed things up, the results of recent computations are kept in a small
+ * LRU cache. Each entry records all values the computation depends on. The
+ * stored tables are reused only if all of them match.
+ */
+struct BplEventCacheEntry
+{
+    // Maximum number of signal changes stored in an entry
+    static constexpr isize maxSignals = 16;
+
+    // Hash over all input values (0 = entry is empty)
+    u64 hash;
+
+    // Input values
+    bool ecs;
+    i8 scrollOdd;
+    i8 scrollEven;
+    bool modified;
+    isize count;
+    i64 keys[maxSignals];
+    u32 signals[maxSignals];
+    DDFState input;
+
+    // Output values
+    DDFState output;
+    isize bprunUp;
+    EventID bplEvent[HPOS_CNT];
+    u8 nextBplEvent[HPOS_CNT];
+
+    // Time stamp of the last access
+    i64 lastUse;
+};
+
 class Sequencer final : public SubComponent
 {
     Descriptions descriptions = {{
@@ -138,7 +174,8 @@ class Sequencer final : public SubComponent
 private:
     
     // Disk, audio, and sprites lookup table ([Bits 0 .. 5 of DMACON])
-    static EventID dasDMA[64][HPOS_CNT];
+    typedef std::array<std::array<EventID, HPOS_CNT>, 64> DasTable;
+    static const DasTable dasDMA;
 
     // Offset into the DAS lookup table
     u16 dmaDAS;
@@ -146,6 +183,15 @@ private:
     // Current layout of a fetch unit
     EventID fetch[2][8];
 
+    // Recently computed bitplane event tables
+    static constexpr isize bplCacheSize = 8;
+    BplEventCacheEntry bplCache[bplCacheSize] = { };
+
+    // Cache statistics
+    i64 bplCacheAccesses = 0;
+    isize bplCacheHits = 0;
+    isize bplCacheMisses = 0;
+
 public:
 
     // Currently scheduled events
@@ -250,7 +296,8 @@ public:
 
 private:
     
-    void initDasEventTable();
+    // Computes the DAS lookup table (at compile time)
+    static constexpr DasTable makeDasEventTable();
 
 
     //
@@ -305,7 +352,6 @@ public:
 
 private:
 
-    void _initialize() override;
     void _dump(Category category, std::ostream& os) const override;
 
 
@@ -363,6 +409,11 @@ private:
     // Processes a signal change
     template <bool ecs> void processSignal(u32 signal, DDFState &state);
 
+    // Looks up or stores the BPL event table for a given input state
+    u64 bplCacheHash(bool ecs, const SigRecorder &sr, const DDFState &state) const;
+    const BplEventCacheEntry *lookupBplEvents(u64 hash, bool ecs, const SigRecorder &sr, const DDFState &state);
+    void cacheBplEvents(u64 hash, bool ecs, const SigRecorder &sr, const DDFState &input, const DDFState &output);
+
     // Updates the jump table for the bplEvent table
     void updateBplJumpTable(i16 end = HPOS_MAX);
 
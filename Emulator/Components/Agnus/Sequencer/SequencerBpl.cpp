@@ -10,6 +10,7 @@
 #include "config.h"
 #include "Sequencer.h"
 #include "Agnus.h"
+#include "Checksum.h"
 
 namespace vamiga {
 
@@ -54,16 +55,36 @@ Sequencer::computeBplEventTable(const SigRecorder &sr)
     
     // Evaluate the current state of the vertical DIW flipflop
     if (!state.bpv) { state.bprun = false; state.cnt = 0; }
-    
-    // Fill the event table
-    if (sr.modified || (state.bpv && state.bmapen) || SEQ_ON_STEROIDS) {
-        computeBplEventsSlow <ecs> (sr, state);
+
+    // Check if the tables have been computed before
+    auto hash = bplCacheHash(ecs, sr, state);
+
+    if (auto entry = lookupBplEvents(hash, ecs, sr, state)) {
+
+        // Restore the cached result
+        std::memcpy(bplEvent, entry->bplEvent, sizeof(bplEvent));
+        std::memcpy(nextBplEvent, entry->nextBplEvent, sizeof(nextBplEvent));
+        bprunUp = entry->bprunUp;
+        state = entry->output;
+        computeFetchUnit(state.bplcon0);
+
     } else {
-        computeBplEventsFast <ecs> (sr, state);
+
+        auto input = state;
+
+        // Fill the event table
+        if (sr.modified || (state.bpv && state.bmapen) || SEQ_ON_STEROIDS) {
+            computeBplEventsSlow <ecs> (sr, state);
+        } else {
+            computeBplEventsFast <ecs> (sr, state);
+        }
+
+        // Update the jump table
+        updateBplJumpTable();
+
+        // Remember the result
+        cacheBplEvents(hash, ecs, sr, input, state);
     }
-    
-    // Update the jump table
-    updateBplJumpTable();
 
     // Rectify the scheduled event
     agnus.scheduleBplEventForCycle(agnus.pos.h);
@@ -446,6 +467,100 @@ Sequencer::processSignal <true> (u32 signal, DDFState &state)
     }
 }
 
+u64
+Sequencer::bplCacheHash(bool ecs, const SigRecorder &sr, const DDFState &state) const
+{
+    // Signal lists that don't fit into a cache entry are never cached
+    if (sr.count() > BplEventCacheEntry::maxSignals || SEQ_ON_STEROIDS) return 0;
+
+    u64 hash = util::fnvInit64();
+
+    hash = util::fnvIt64(hash, ecs);
+    hash = util::fnvIt64(hash, u8(agnus.scrollOdd) | u8(agnus.scrollEven) << 8);
+    hash = util::fnvIt64(hash, sr.modified);
+    hash = util::fnvIt64(hash,
+                         u64(state.bpv)      << 0 |
+                         u64(state.bmapen)   << 1 |
+                         u64(state.shw)      << 2 |
+                         u64(state.rhw)      << 3 |
+                         u64(state.bphstart) << 4 |
+                         u64(state.bphstop)  << 5 |
+                         u64(state.bprun)    << 6 |
+                         u64(state.lastFu)   << 7 |
+                         u64(state.stopreq)  << 8 |
+                         u64(state.cnt)      << 16 |
+                         u64(state.bplcon0)  << 32);
+
+    for (isize i = 0; i < sr.count(); i++) {
+        hash = util::fnvIt64(hash, u64(sr.keys[i]) << 32 | sr.elements[i]);
+    }
+
+    return hash ? hash : 1;
+}
+
+const BplEventCacheEntry *
+Sequencer::lookupBplEvents(u64 hash, bool ecs, const SigRecorder &sr, const DDFState &state)
+{
+    if (!hash) return nullptr;
+
+    for (isize i = 0; i < bplCacheSize; i++) {
+
+        auto &entry = bplCache[i];
+
+        // Compare the hash first and verify all input values afterwards
+        if (entry.hash != hash) continue;
+        if (entry.ecs != ecs ||
+            entry.scrollOdd != agnus.scrollOdd ||
+            entry.scrollEven != agnus.scrollEven ||
+            entry.modified != sr.modified ||
+            entry.count != sr.count() ||
+            entry.input != state) continue;
+
+        bool match = true;
+        for (isize j = 0; j < entry.count && match; j++) {
+            match = entry.keys[j] == sr.keys[j] && entry.signals[j] == sr.elements[j];
+        }
+        if (!match) continue;
+
+        entry.lastUse = ++bplCacheAccesses;
+        bplCacheHits++;
+        return &entry;
+    }
+
+    bplCacheMisses++;
+    return nullptr;
+}
+
+void
+Sequencer::cacheBplEvents(u64 hash, bool ecs, const SigRecorder &sr,
+                          const DDFState &input, const DDFState &output)
+{
+    if (!hash) return;
+
+    // Replace the least recently used entry
+    auto *entry = &bplCache[0];
+    for (isize i = 1; i < bplCacheSize; i++) {
+        if (bplCache[i].lastUse < entry->lastUse) entry = &bplCache[i];
+    }
+
+    entry->hash = hash;
+    entry->ecs = ecs;
+    entry->scrollOdd = agnus.scrollOdd;
+    entry->scrollEven = agnus.scrollEven;
+    entry->modified = sr.modified;
+    entry->count = sr.count();
+    for (isize i = 0; i < entry->count; i++) {
+        entry->keys[i] = sr.keys[i];
+        entry->signals[i] = sr.elements[i];
+    }
+    entry->input = input;
+    entry->output = output;
+    entry->bprunUp = bprunUp;
+    std::memcpy(entry->bplEvent, bplEvent, sizeof(bplEvent));
+    std::memcpy(entry->nextBplEvent, nextBplEvent, sizeof(nextBplEvent));
+    entry->lastUse = ++bplCacheAccesses;
+}
+
 void
 Sequencer::updateBplJumpTable(i16 end)
 {
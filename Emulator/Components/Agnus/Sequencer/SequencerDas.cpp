@@ -12,16 +12,14 @@
 
 namespace vamiga {
 
-EventID Sequencer::dasDMA[64][HPOS_CNT];
-
-void
-Sequencer::initDasEventTable()
+constexpr Sequencer::DasTable
+Sequencer::makeDasEventTable()
 {
-    std::memset(dasDMA, 0, sizeof(dasDMA));
+    DasTable table = { };
 
     for (isize enable = 0; enable < 64; enable++) {
 
-        EventID *p = dasDMA[enable];
+        auto &p = table[enable];
 
         p[0x01] = DAS_REFRESH;
 
@@ -66,8 +64,12 @@ Sequencer::initDasEventTable()
         p[0xE2] = DAS_EOL;
         p[0xE3] = DAS_EOL;
     }
+
+    return table;
 }
 
+constinit const Sequencer::DasTable Sequencer::dasDMA = makeDasEventTable();
+
 void
 Sequencer::initDasEvents()
 {
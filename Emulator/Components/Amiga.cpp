@@ -159,6 +159,10 @@ Amiga::_didReset(bool hard)
     // Clear all runloop flags
     flags = 0;
 
+    // Keep profiling guest code and tracing instructions
+    if (guestProfiler.isRunning()) flags |= RL::GUEST_PROFILER;
+    if (tracer.isOpen()) flags |= RL::INSTR_TRACER;
+
     // Inform the GUI
     if (hard) msgQueue.put(MSG_RESET);
 }
@@ -177,6 +181,9 @@ Amiga::getOption(Option option) const
         case OPT_AMIGA_SNAP_AUTO:       return config.snapshots;
         case OPT_AMIGA_SNAP_DELAY:      return config.snapshotDelay;
         case OPT_AMIGA_SNAP_COMPRESS:   return config.compressSnapshots;
+        case OPT_AMIGA_REWIND:          return config.rewind;
+        case OPT_AMIGA_REWIND_KEYS:     return config.rewindKeys;
+        case OPT_AMIGA_REWIND_SIZE:     return config.rewindSize;
 
         default:
             fatalError;
@@ -236,7 +243,22 @@ Amiga::checkOption(Option opt, i64 value)
             return;
 
         case OPT_AMIGA_SNAP_COMPRESS:
+        case OPT_AMIGA_REWIND:
+
+            return;
 
+        case OPT_AMIGA_REWIND_KEYS:
+
+            if (value < 1 || value > 500) {
+                throw Error(VAERROR_OPT_INV_ARG, "1...500");
+            }
+            return;
+
+        case OPT_AMIGA_REWIND_SIZE:
+
+            if (value < 8 || value > 4096) {
+                throw Error(VAERROR_OPT_INV_ARG, "8...4096");
+            }
             return;
             
         default:
@@ -299,6 +321,24 @@ Amiga::setOption(Option option, i64 value)
 
             config.compressSnapshots = bool(value);
             return;
+
+        case OPT_AMIGA_REWIND:
+
+            config.rewind = bool(value);
+            if (!config.rewind) rewindBuffer.clear();
+            return;
+
+        case OPT_AMIGA_REWIND_KEYS:
+
+            config.rewindKeys = isize(value);
+            rewindBuffer.setKeyInterval(config.rewindKeys);
+            return;
+
+        case OPT_AMIGA_REWIND_SIZE:
+
+            config.rewindSize = isize(value);
+            rewindBuffer.setBudget(MB(config.rewindSize));
+            return;
             
         default:
             fatalError;
@@ -580,6 +620,9 @@ Amiga::_dump(Category category, std::ostream& os) const
 
         os << tab("Frame");
         os << dec(agnus.pos.frame) << std::endl;
+        os << tab("Rewind buffer");
+        os << dec(rewindBuffer.count()) << " frames (";
+        os << dec(rewindBuffer.memoryUsage() / 1024) << " KB)" << std::endl;
         os << tab("CPU progress");
         os << dec(cpu.getMasterClock()) << " Master cycles (";
         os << dec(cpu.getCpuClock()) << " CPU cycles)" << std::endl;
@@ -730,11 +773,18 @@ Amiga::update(CmdQueue &queue)
     Cmd cmd;
     bool cmdConfig = false;
 
-    auto dfn = [&]() -> FloppyDrive& { return *df[cmd.value]; };
-
     // Process all commands
     while (queue.poll(cmd)) {
 
+        if (InputRecorder::isInput(cmd)) {
+
+            // Drop live input while a movie is replayed
+            if (inputRecorder.isReplaying()) continue;
+
+            // Log the event if a movie is recorded
+            inputRecorder.record(cmd);
+        }
+
         switch (cmd.type) {
 
             case CMD_CONFIG:
@@ -776,37 +826,27 @@ Amiga::update(CmdQueue &queue)
             case CMD_KEY_RELEASE:
             case CMD_KEY_RELEASE_ALL:
             case CMD_KEY_TOGGLE:
-
-                keyboard.processCommand(cmd);
-                break;
-
             case CMD_MOUSE_MOVE_ABS:
             case CMD_MOUSE_MOVE_REL:
-            {
-                auto &port = cmd.coord.port ? controlPort2 : controlPort1;
-                port.processCommand(cmd); break;
-                break;
-            }
             case CMD_MOUSE_EVENT:
             case CMD_JOY_EVENT:
-            {
-                auto &port = cmd.action.port ? controlPort2 : controlPort1;
-                port.processCommand(cmd); break;
-                break;
-            }
             case CMD_DSK_TOGGLE_WP:
             case CMD_DSK_MODIFIED:
             case CMD_DSK_UNMODIFIED:
 
-                dfn().processCommand(cmd);
+                processInput(cmd);
                 break;
 
-                
             case CMD_RSH_EXECUTE:
 
                 retroShell.exec();
                 break;
 
+            case CMD_SRV_RECEIVE:
+
+                remoteManager.processCommand(cmd);
+                break;
+
             case CMD_FOCUS:
 
                 cmd.value ? focus() : unfocus();
@@ -824,9 +864,60 @@ Amiga::update(CmdQueue &queue)
     if (retroShell.isDirty) { retroShell.isDirty = false; msgQueue.put(MSG_RSH_UPDATE); }
 }
 
+void
+Amiga::processInput(const Cmd &cmd)
+{
+    switch (cmd.type) {
+
+        case CMD_KEY_PRESS:
+        case CMD_KEY_RELEASE:
+        case CMD_KEY_RELEASE_ALL:
+        case CMD_KEY_TOGGLE:
+
+            keyboard.processCommand(cmd);
+            break;
+
+        case CMD_MOUSE_MOVE_ABS:
+        case CMD_MOUSE_MOVE_REL:
+        {
+            auto &port = cmd.coord.port ? controlPort2 : controlPort1;
+            port.processCommand(cmd);
+            break;
+        }
+        case CMD_MOUSE_EVENT:
+        case CMD_JOY_EVENT:
+        {
+            auto &port = cmd.action.port ? controlPort2 : controlPort1;
+            port.processCommand(cmd);
+            break;
+        }
+        case CMD_DSK_TOGGLE_WP:
+        case CMD_DSK_MODIFIED:
+        case CMD_DSK_UNMODIFIED:
+
+            df[cmd.value]->processCommand(cmd);
+            break;
+
+        default:
+            fatal("Unhandled command: %s\n", CmdTypeEnum::key(cmd.type));
+    }
+}
+
+void
+Amiga::replayInput()
+{
+    Cmd cmd;
+    while (inputRecorder.poll(cmd)) processInput(cmd);
+}
+
 void
 Amiga::computeFrame()
 {
+    // Feed in the recorded input events that are due (if a movie is replayed)
+    if (flags & RL::INPUT_REPLAY) replayInput();
+
+    profiler.beginFrame();
+
     while (1) {
 
         // Emulate the next CPU instruction
@@ -835,6 +926,24 @@ Amiga::computeFrame()
         // Check if special action needs to be taken
         if (flags) {
 
+            // Are we profiling guest code?
+            if (flags & RL::GUEST_PROFILER) {
+                if (guestProfiler.isRunning()) {
+                    guestProfiler.record();
+                } else {
+                    clearFlag(RL::GUEST_PROFILER);
+                }
+            }
+
+            // Are we tracing instructions?
+            if (flags & RL::INSTR_TRACER) {
+                if (tracer.isOpen()) {
+                    traceInstruction();
+                } else {
+                    clearFlag(RL::INSTR_TRACER);
+                }
+            }
+
             // Did we reach a soft breakpoint?
             if (flags & RL::SOFTSTOP_REACHED) {
                 clearFlag(RL::SOFTSTOP_REACHED);
@@ -916,8 +1025,26 @@ Amiga::computeFrame()
                 clearFlag(RL::SYNC_THREAD);
                 break;
             }
+
+            /* Are we replaying a movie? Recorded events are fed in after the
+             * instruction that completed at the recorded cycle. Events at the
+             * end of a frame are handled at the beginning of the next one,
+             * like the command queue does when the movie is recorded.
+             */
+            if (flags & RL::INPUT_REPLAY) {
+                if (inputRecorder.isReplaying()) {
+                    if (inputRecorder.isDue(agnus.clock)) replayInput();
+                } else {
+                    clearFlag(RL::INPUT_REPLAY);
+                }
+            }
         }
     }
+
+    profiler.endFrame();
+
+    // Record the frame (main instance only)
+    if (config.rewind && objid == 0) rewindBuffer.record();
 }
 
 void
@@ -925,8 +1052,13 @@ Amiga::fastForward(isize frames)
 {
     auto target = agnus.pos.frame + frames;
 
+    // Skip pixel synthesis in all intermediate frames if requested
+    headless = headlessFastForward;
+
     // Execute until the target frame has been reached
     while (agnus.pos.frame < target) computeFrame();
+
+    headless = false;
 }
 
 void
@@ -1049,6 +1181,128 @@ Amiga::loadSnapshot(const Snapshot &snap)
     msgQueue.put(MSG_VIDEO_FORMAT, agnus.isPAL() ? PAL : NTSC);
 }
 
+void
+Amiga::rewind(i64 frame)
+{
+    {   SUSPENDED
+
+        rewindBuffer.seek(frame);
+    }
+
+    // Inform the GUI
+    msgQueue.put(MSG_SNAPSHOT_RESTORED);
+    msgQueue.put(MSG_VIDEO_FORMAT, agnus.isPAL() ? PAL : NTSC);
+}
+
+void
+Amiga::startInputRecording()
+{
+    SUSPENDED
+
+    inputRecorder.startRecording();
+}
+
+void
+Amiga::stopInputRecording()
+{
+    SUSPENDED
+
+    inputRecorder.stopRecording();
+}
+
+void
+Amiga::saveMovie(const std::filesystem::path &path)
+{
+    SUSPENDED
+
+    inputRecorder.stopRecording();
+    inputRecorder.saveMovie(path);
+}
+
+void
+Amiga::replayMovie(const std::filesystem::path &path)
+{
+    SUSPENDED
+
+    inputRecorder.loadMovie(path);
+    inputRecorder.startReplay();
+    setFlag(RL::INPUT_REPLAY);
+}
+
+void
+Amiga::startGuestProfiling(isize interval)
+{
+    SUSPENDED
+
+    guestProfiler.start(interval);
+    setFlag(RL::GUEST_PROFILER);
+}
+
+void
+Amiga::stopGuestProfiling()
+{
+    SUSPENDED
+
+    guestProfiler.stop();
+    clearFlag(RL::GUEST_PROFILER);
+}
+
+void
+Amiga::saveGuestProfile(const std::filesystem::path &path)
+{
+    SUSPENDED
+
+    guestProfiler.saveProfile(path);
+}
+
+void
+Amiga::startTracing(const std::filesystem::path &path, isize bytes)
+{
+    SUSPENDED
+
+    auto &config = cpu.getConfig();
+    tracer.open(path, bytes, u8(config.revision), u8(config.dasmRevision));
+    setFlag(RL::INSTR_TRACER);
+}
+
+void
+Amiga::stopTracing()
+{
+    SUSPENDED
+
+    tracer.close();
+    clearFlag(RL::INSTR_TRACER);
+}
+
+void
+Amiga::traceInstruction()
+{
+    // Skip the idle cycles of a stopped CPU
+    if (cpu.isStopped()) return;
+
+    trace::Record record;
+
+    record.clock = cpu.getClock();
+    record.pc = cpu.getPC0();
+    record.sr = cpu.getSR();
+    record.mask = 0;
+
+    // The first two words are already in the prefetch queue
+    record.words[0] = cpu.getIRD();
+    record.words[1] = cpu.getIRC();
+    for (isize i = 2; i < trace::maxWords; i++) {
+        record.words[i] = mem.spypeek16 <ACCESSOR_CPU> (record.pc + 2 * u32(i));
+    }
+
+    for (int i = 0; i < 8; i++) {
+
+        record.regs[i] = cpu.getD(i);
+        record.regs[8 + i] = cpu.getA(i);
+    }
+
+    tracer.write(record);
+}
+
 /*
 void
 Amiga::takeAutoSnapshot()
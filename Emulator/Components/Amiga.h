@@ -36,13 +36,18 @@
 
 // Misc
 #include "GdbServer.h"
+#include "GuestProfiler.h"
 #include "Host.h"
+#include "InputRecorder.h"
 #include "OSDebugger.h"
+#include "Profiler.h"
 #include "RegressionTester.h"
 #include "RemoteManager.h"
 #include "RetroShell.h"
+#include "RewindBuffer.h"
 #include "RshServer.h"
 #include "SerialPort.h"
+#include "TraceFile.h"
 
 namespace vamiga {
 
@@ -75,7 +80,10 @@ class Amiga final : public CoreComponent, public Inspectable<AmigaInfo> {
         OPT_AMIGA_RUN_AHEAD,
         OPT_AMIGA_SNAP_AUTO,
         OPT_AMIGA_SNAP_DELAY,
-        OPT_AMIGA_SNAP_COMPRESS
+        OPT_AMIGA_SNAP_COMPRESS,
+        OPT_AMIGA_REWIND,
+        OPT_AMIGA_REWIND_KEYS,
+        OPT_AMIGA_REWIND_SIZE
     };
     
     // The current configuration
@@ -141,6 +149,21 @@ public:
     OSDebugger osDebugger = OSDebugger(*this);
     RegressionTester regressionTester = RegressionTester(*this);
 
+    // Recently emulated frames
+    RewindBuffer rewindBuffer = RewindBuffer(*this);
+
+    // Recorded input events
+    InputRecorder inputRecorder = InputRecorder(*this);
+
+    // Host time measurements
+    Profiler profiler;
+
+    // Guest code measurements
+    GuestProfiler guestProfiler = GuestProfiler(*this);
+
+    // Binary instruction trace
+    TraceWriter tracer;
+
     // Shortcuts
     FloppyDrive *df[4] = { &df0, &df1, &df2, &df3 };
     HardDrive *hd[4] = { &hd0, &hd1, &hd2, &hd3 };
@@ -161,6 +184,16 @@ private:
      */
     RunLoopFlags flags = 0;
 
+    /* Indicates whether fastForward() skips pixel synthesis. If set, Denise
+     * emulates all fast-forwarded frames without colorizing pixels and the
+     * DMA debugger draws no overlays. All architecturally visible state,
+     * including the collision registers, is computed as usual.
+     */
+    bool headlessFastForward = true;
+
+    // Indicates whether the current frame is emulated without rendering
+    bool headless = false;
+
 
     //
     // Storage
@@ -387,6 +420,12 @@ public:
     // Fast-forward the run-ahead instance
     void fastForward(isize frames);
 
+    // Selects whether fastForward() renders the skipped frames
+    void setHeadlessFastForward(bool value) { headlessFastForward = value; }
+
+    // Checks whether the current frame is emulated without rendering
+    bool isHeadless() const { return headless; }
+
 
     //
     // Controlling the run loop
@@ -437,6 +476,9 @@ public:
     void loadSnapshot(const MediaFile &file) throws;
     void loadSnapshot(const class Snapshot &snapshot) throws;
 
+    // Restores a frame from the rewind buffer
+    void rewind(i64 frame) throws;
+
     // Services a snapshot event
     void serviceSnpEvent(EventID id);
 
@@ -446,6 +488,53 @@ private:
     void scheduleNextSnpEvent();
 
 
+    //
+    // Recording inputs
+    //
+
+public:
+
+    // Starts or stops logging all input events
+    void startInputRecording();
+    void stopInputRecording();
+
+    // Saves the recorded input events together with the initial state
+    void saveMovie(const std::filesystem::path &path) throws;
+
+    // Restores the initial state of a movie and replays its input events
+    void replayMovie(const std::filesystem::path &path) throws;
+
+
+    //
+    // Profiling guest code
+    //
+
+public:
+
+    // Starts or stops the guest profiler (interval 0 = count every instruction)
+    void startGuestProfiling(isize interval = 0);
+    void stopGuestProfiling();
+
+    // Writes the collected samples in collapsed stack format
+    void saveGuestProfile(const std::filesystem::path &path) throws;
+
+
+    //
+    // Tracing instructions
+    //
+
+public:
+
+    // Starts or stops writing a binary instruction trace
+    void startTracing(const std::filesystem::path &path, isize bytes) throws;
+    void stopTracing();
+
+private:
+
+    // Writes the upcoming instruction into the trace file
+    void traceInstruction();
+
+
     //
     // Managing commands and events
     //
@@ -455,6 +544,12 @@ public:
     // Processes a command from the command queue
     void processCommand(const Cmd &cmd);
 
+    // Processes an input event (keyboard, mouse, joystick, or floppy drive)
+    void processInput(const Cmd &cmd);
+
+    // Feeds in all recorded input events that are due
+    void replayInput();
+
     // End-of-line handler
     void eolHandler();
 
@@ -324,6 +324,15 @@ typedef struct
     
     //! Indicates whether snapshots should be stored in compressed form
     bool compressSnapshots;
+
+    //! Indicates whether frames are recorded in the rewind buffer
+    bool rewind;
+
+    //! Number of frames between two keyframes in the rewind buffer
+    isize rewindKeys;
+
+    //! Memory budget of the rewind buffer in MB
+    isize rewindSize;
 }
 AmigaConfig;
 
@@ -362,6 +371,9 @@ constexpr u32 COPPERWP_REACHED   = (1 << 8);
 constexpr u32 AUTO_SNAPSHOT      = (1 << 9);
 constexpr u32 USER_SNAPSHOT      = (1 << 10);
 constexpr u32 SYNC_THREAD        = (1 << 11);
+constexpr u32 GUEST_PROFILER     = (1 << 12);
+constexpr u32 INSTR_TRACER       = (1 << 13);
+constexpr u32 INPUT_REPLAY       = (1 << 14);
 };
 
 #endif
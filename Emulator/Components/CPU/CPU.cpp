@@ -42,11 +42,12 @@ Moira::sync(int cycles)
         auto microCyclesPerCycle = 2 * cpu->config.overclocking;
 
         // Execute some cycles at normal speed if required
-        while (cpu->slowCycles && cycles) {
+        if (cpu->slowCycles && cycles) {
 
-            cpu->debt += microCyclesPerCycle;
-            cycles--;
-            cpu->slowCycles--;
+            auto slow = std::min(i64(cycles), cpu->slowCycles);
+            cpu->debt += slow * microCyclesPerCycle;
+            cpu->slowCycles -= slow;
+            cycles -= int(slow);
         }
 
         // Execute all other cycles
@@ -54,13 +55,14 @@ Moira::sync(int cycles)
 
         while (cpu->debt >= microCyclesPerCycle) {
 
-            // Advance the CPU clock by one DMA cycle
-            clock += 2;
+            // Emulate Agnus up to the next event in a single step
+            auto chunk = std::min(cpu->debt / microCyclesPerCycle, agnus.cyclesUntilNextTrigger());
 
-            // Emulate Agnus for one DMA cycle
-            agnus.execute();
+            // Advance the CPU clock by the same number of DMA cycles
+            clock += 2 * chunk;
+            agnus.execute(chunk);
 
-            cpu->debt -= microCyclesPerCycle;
+            cpu->debt -= chunk * microCyclesPerCycle;
         }
     }
 }
@@ -68,20 +70,31 @@ Moira::sync(int cycles)
 u8
 Moira::read8(u32 addr) const
 {
-    return mem.peek8<ACCESSOR_CPU>(addr);
+    return mem.cpuPeek8(addr);
 }
 
 u16
 Moira::read16(u32 addr) const
 {
-    return mem.peek16<ACCESSOR_CPU>(addr);
+    return mem.cpuPeek16(addr);
 }
 
 u16
 Moira::read16Dasm(u32 addr) const
 {
-    auto result = mem.spypeek16<ACCESSOR_CPU>(addr);
-    
+    u16 result;
+
+    if (cpu.dasmBuffer) {
+
+        // Read from the instruction buffer
+        auto i = isize((addr - cpu.dasmBufferAddr) >> 1);
+        result = i < cpu.dasmBufferLen ? cpu.dasmBuffer[i] : 0;
+
+    } else {
+
+        result = mem.spypeek16<ACCESSOR_CPU>(addr);
+    }
+
     // For LINE-A instructions, check if the opcode is a software trap
     if (Debugger::isLineAInstr(result)) result = debugger.swTraps.resolve(result);
 
@@ -100,7 +113,7 @@ Moira::write8(u32 addr, u8 val) const
     if (XFILES) {
         if (addr - reg.pc < 5) xfiles("write8 close to PC %x\n", reg.pc);
     }
-    mem.poke8 <ACCESSOR_CPU> (addr, val);
+    mem.cpuPoke8(addr, val);
 }
 
 void
@@ -109,7 +122,7 @@ Moira::write16(u32 addr, u16 val) const
     if (XFILES) {
         if (addr - reg.pc < 5) xfiles("write16 close to PC %x\n", reg.pc);
     }
-    mem.poke16 <ACCESSOR_CPU> (addr, val);
+    mem.cpuPoke16(addr, val);
 }
 
 u16
@@ -627,14 +640,11 @@ CPU::_didLoad()
 }
 
 void
-CPU::resyncOverclockedCpu()
+CPU::completeDmaCycle()
 {
-    if (debt) {
-
-        clock += 2;
-        agnus.execute();
-        debt = 0;
-    }
+    clock += 2;
+    agnus.execute();
+    debt = 0;
 }
 
 const char *
@@ -651,59 +661,60 @@ CPU::disassembleRecordedWords(isize i, isize len)
 const char *
 CPU::disassembleRecordedFlags(isize i)
 {
-    static char result[18];
-    
-    disassembleSR(result, debugger.logEntryAbs((int)i).sr);
-    return result;
+    disassembleSR(dasmFlags, debugger.logEntryAbs((int)i).sr);
+    return dasmFlags;
 }
 
 const char *
 CPU::disassembleRecordedPC(isize i)
 {
-    static char result[16];
-
-    Moira::dump24(result, debugger.logEntryAbs((int)i).pc0);
-    return result;
+    Moira::dump24(dasmPC, debugger.logEntryAbs((int)i).pc0);
+    return dasmPC;
 }
 
 const char *
 CPU::disassembleAddr(u32 addr)
 {
-    static char result[16];
-
-    Moira::dump24(result, addr);
-    return result;
+    Moira::dump24(dasmAddr, addr);
+    return dasmAddr;
 }
 
 const char *
 CPU::disassembleWord(u16 value)
 {
-    static char result[16];
-
-    Moira::dump16(result, value);
-    return result;
+    Moira::dump16(dasmWord, value);
+    return dasmWord;
 }
 
 const char *
 CPU::disassembleInstr(u32 addr, isize *len)
 {
-    static char result[128];
-
-    int l = disassemble(result, addr);
+    int l = disassemble(dasmInstr, addr);
 
     if (len) *len = (isize)l;
-    return result;
+    return dasmInstr;
 }
 
 const char *
-CPU::disassembleWords(u32 addr, isize len)
+CPU::disassembleInstr(u32 addr, const u16 *words, isize count, isize *len)
 {
-    static char result[64];
+    dasmBuffer = words;
+    dasmBufferAddr = addr;
+    dasmBufferLen = count;
 
-    dump16(result, addr, (int)len);
+    auto result = disassembleInstr(addr, len);
+
+    dasmBuffer = nullptr;
     return result;
 }
 
+const char *
+CPU::disassembleWords(u32 addr, isize len)
+{
+    dump16(dasmWords, addr, (int)len);
+    return dasmWords;
+}
+
 const char *
 CPU::disassembleInstr(isize *len)
 {
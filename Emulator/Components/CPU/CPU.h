@@ -55,6 +55,23 @@ public:
     // Number of cycles that should be executed at normal speed (overclocking)
     i64 slowCycles;
 
+private:
+
+    // Text buffers returned by the disassembler functions
+    char dasmFlags[18];
+    char dasmPC[16];
+    char dasmAddr[16];
+    char dasmWord[16];
+    char dasmInstr[128];
+    char dasmWords[64];
+
+public:
+
+    // Instruction words fed to the disassembler instead of memory (if set)
+    const u16 *dasmBuffer = nullptr;
+    u32 dasmBufferAddr = 0;
+    isize dasmBufferLen = 0;
+
 
     //
     // Initializing
@@ -245,7 +262,14 @@ public:
     void addWaitStates(Cycle cycles) { clock += AS_CPU_CYCLES(cycles); }
     
     // Resynchronizes an overclocked CPU with the Agnus clock
-    void resyncOverclockedCpu();
+    void resyncOverclockedCpu() { if (debt) completeDmaCycle(); }
+
+private:
+
+    // Finishes the DMA cycle that is partially executed by the CPU
+    void completeDmaCycle();
+
+public:
 
 
     //
@@ -264,6 +288,9 @@ public:
     const char *disassembleInstr(u32 addr, isize *len);
     const char *disassembleWords(u32 addr, isize len);
 
+    // Disassembles an instruction from a buffer (e.g., a recorded trace)
+    const char *disassembleInstr(u32 addr, const u16 *words, isize count, isize *len);
+
     // Disassembles the currently executed instruction
     const char *disassembleInstr(isize *len);
     const char *disassembleWords(isize len);
@@ -210,6 +210,9 @@ public:
     // Returns true if the CPU is in HALT state
     bool isHalted() const { return flags & CPU_IS_HALTED; }
 
+    // Returns true if the CPU is in STOP state
+    bool isStopped() const { return flags & CPU_IS_STOPPED; }
+
 private:
 
     // Processes an exception that was catched in execute()
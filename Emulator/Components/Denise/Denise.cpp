@@ -934,16 +934,11 @@ Denise::drawSpritePair(Pixel hstrt, Pixel hstop, Pixel strt1, Pixel strt2)
         }
     }
 
-    // Perform collision checks (if enabled)
-    if (config.clxSprSpr) {
-        
-        checkS2SCollisions<2 * pair>(strt1, strt1 + 31);
-        checkS2SCollisions<2 * pair + 1>(strt2, strt2 + 31);
-    }
-    if (config.clxSprPlf) {
-        
-        checkS2PCollisions<2 * pair>(strt1, strt1 + 31);
-        checkS2PCollisions<2 * pair + 1>(strt2, strt2 + 31);
+    // Schedule collision checks (if enabled)
+    if (config.clxSprSpr || config.clxSprPlf) {
+
+        recordSpriteCollisionCheck<2 * pair>(strt1);
+        recordSpriteCollisionCheck<2 * pair + 1>(strt2);
     }
 }
 
@@ -1121,12 +1116,58 @@ Denise::markBorderBufferAsDirty(isize lines)
     borderBufferIsDirty = std::max(borderBufferIsDirty, lines);
 }
 
+template <int x> void
+Denise::recordSpriteCollisionCheck(Pixel start)
+{
+    // Skip if the range has been recorded already
+    for (isize i = 0; i < clxSpans[x]; i++) if (clxSpan[x][i] == start) return;
+
+    // Check the oldest range right away if there is no space left
+    if (clxSpans[x] == clxMaxSpans) {
+
+        if (config.clxSprSpr) checkS2SCollisions<x>(clxSpan[x][0], clxSpan[x][0] + 31);
+        if (config.clxSprPlf) checkS2PCollisions<x>(clxSpan[x][0], clxSpan[x][0] + 31);
+
+        for (isize i = 1; i < clxMaxSpans; i++) clxSpan[x][i - 1] = clxSpan[x][i];
+        clxSpans[x]--;
+    }
+
+    clxSpan[x][clxSpans[x]++] = start;
+}
+
+void
+Denise::checkSpriteCollisions()
+{
+    checkSpriteCollisions<0>();
+    checkSpriteCollisions<1>();
+    checkSpriteCollisions<2>();
+    checkSpriteCollisions<3>();
+    checkSpriteCollisions<4>();
+    checkSpriteCollisions<5>();
+    checkSpriteCollisions<6>();
+    checkSpriteCollisions<7>();
+}
+
+template <int x> void
+Denise::checkSpriteCollisions()
+{
+    for (isize i = 0; i < clxSpans[x]; i++) {
+
+        if (config.clxSprSpr) checkS2SCollisions<x>(clxSpan[x][i], clxSpan[x][i] + 31);
+        if (config.clxSprPlf) checkS2PCollisions<x>(clxSpan[x][i], clxSpan[x][i] + 31);
+    }
+    clxSpans[x] = 0;
+}
+
 template <int x> void
 Denise::checkS2SCollisions(Pixel start, Pixel end)
 {
     // For odd sprites, only proceed if collision detection is enabled
     if constexpr (IS_ODD(x)) if (!GET_BIT(clxcon, 12 + (x/2))) return;
 
+    // Quick-exit if all sprite-sprite collision bits are already set
+    if ((clxdat & 0x7E00) == 0x7E00) return;
+
     // Set up the sprite comparison masks
     u16 comp01 = Z_SP0 | (GET_BIT(clxcon, 12) ? Z_SP1 : 0);
     u16 comp23 = Z_SP2 | (GET_BIT(clxcon, 13) ? Z_SP3 : 0);
@@ -1169,6 +1210,10 @@ Denise::checkS2PCollisions(Pixel start, Pixel end)
 {
     // For the odd sprites, only proceed if collision detection is enabled
     if constexpr (IS_ODD(x)) if (!ensp<x>()) return;
+
+    // Quick-exit if both collision bits are already set
+    constexpr u16 bits = 1 << (5 + x / 2) | 1 << (1 + x / 2);
+    if ((clxdat & bits) == bits) return;
     
     u8 enabled1 = enbp1();
     u8 enabled2 = enbp2();
@@ -1260,28 +1305,47 @@ Denise::hsyncHandler(isize vpos)
     updateBorderBuffer();
 
     // Check if we are below the VBLANK area
-    if (vpos >= 26 && !frameSkips) {
+    if (vpos >= 26 && !frameSkips && !amiga.isHeadless()) {
 
         // Translate bitplane data to color register indices
+        amiga.profiler.enter(PROF_TRANSLATE);
         translate();
+        amiga.profiler.leave();
 
         // Draw sprites
+        amiga.profiler.enter(PROF_SPRITES);
         drawSprites();
+        amiga.profiler.leave();
+
+        // Perform sprite collision checks (if enabled)
+        checkSpriteCollisions();
 
         // Perform playfield-playfield collision check (if enabled)
         if (config.clxPlfPlf) checkP2PCollisions();
 
         // Synthesize RGBA values and write the result into the frame buffer
+        amiga.profiler.enter(PROF_COLORIZE);
         pixelEngine.colorize(vpos);
+        amiga.profiler.leave();
 
         // Remove certain graphics layers if requested
         if (config.hiddenLayers) {
             pixelEngine.hide(vpos, config.hiddenLayers, config.hiddenLayerAlpha);
         }
         
+    } else if (vpos >= 26 && (config.clxSprSpr || config.clxSprPlf || config.clxPlfPlf)) {
+
+        // The line is not displayed, but the collision checks need the z buffer
+        translate();
+        drawSprites();
+        checkSpriteCollisions();
+        if (config.clxPlfPlf) checkP2PCollisions();
+        pixelEngine.replayColRegChanges();
+
     } else {
         
         drawSprites();
+        checkSpriteCollisions();
         pixelEngine.replayColRegChanges();
         conChanges.clear();
     }
@@ -23,6 +23,7 @@ namespace vamiga {
 class Denise final : public SubComponent, public Inspectable<DeniseInfo> {
 
     friend class DeniseDebugger;
+    friend class Bench;
 
     Descriptions descriptions = {{
 
@@ -284,6 +285,17 @@ public:
     u8 mBuffer[HPIXELS + (4 * 16) + 8];
     u16 zBuffer[HPIXELS + (4 * 16) + 8];
 
+    /* Sprite collisions are checked lazily. While sprites are drawn, only the
+     * start positions of the drawn sprite pixel ranges are recorded. The
+     * ranges are checked at the end of the line when all sprites have been
+     * written into the z buffer. Ranges that show up more than once, e.g.,
+     * because the sprite data registers changed in the middle of the line,
+     * are checked only once.
+     */
+    static constexpr isize clxMaxSpans = 4;
+    Pixel clxSpan[8][clxMaxSpans];
+    isize clxSpans[8] = { };
+
     static constexpr u16 Z_0   = 0b10000000'00000000;
     static constexpr u16 Z_SP0 = 0b01000000'00000000;
     static constexpr u16 Z_SP1 = 0b00100000'00000000;
@@ -624,6 +636,13 @@ private:
 
 private:
 
+    // Records a sprite pixel range for the next sprite collision check
+    template <int x> void recordSpriteCollisionCheck(Pixel start);
+
+    // Checks all recorded sprite pixel ranges for collisions
+    void checkSpriteCollisions();
+    template <int x> void checkSpriteCollisions();
+
     // Checks for sprite-sprite collisions in the current rasterline
     template <int x> void checkS2SCollisions(Pixel start, Pixel end);
 
@@ -167,12 +167,17 @@ Emulator::cacheStats(EmulatorStats &result) const
         result.resyncs = resyncs;
     }
 
+    result.msgDropped = main.msgQueue.dropped;
+    result.msgCoalesced = main.msgQueue.coalesced;
+    result.cmdDropped = cmdQueue.dropped;
+
+    main.profiler.getStats(result.profiler);
 }
 
-void
+bool
 Emulator::put(const Cmd &cmd)
 {
-    cmdQueue.put(cmd);
+    return cmdQueue.put(cmd);
 }
 
 i64
@@ -218,7 +223,7 @@ Emulator::update()
     shouldWarp() ? warpOn() : warpOff();
 
     // Mark the run-ahead instance dirty when the command queue has entries
-    isDirty |= !cmdQueue.empty;
+    isDirty |= !cmdQueue.isEmpty();
 
     // Process all commands
     main.update(cmdQueue);
@@ -34,7 +34,7 @@ public:
     // Indicates if the run-ahead instance needs to be updated
     bool isDirty = true;
 
-    // User default settings
+    // User default settings (shared by all emulator instances)
     static Defaults defaults;
 
     // Incoming external events
@@ -165,8 +165,8 @@ public:
 
 public:
 
-    // Feeds a command into the command queue
-    void put(const Cmd &cmd);
+    // Feeds a command into the command queue (returns false if it is full)
+    bool put(const Cmd &cmd);
     void put(CmdType type, i64 payload = 0, i64 payload2 = 0) { put(Cmd(type, payload, payload2)); }
     void put(CmdType type, ConfigCmd payload)  { put(Cmd(type, payload)); }
     void put(CmdType type, KeyCmd payload)  { put(Cmd(type, payload)); }
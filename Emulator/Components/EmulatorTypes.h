@@ -12,6 +12,7 @@
 #include "Reflection.h"
 #include "ThreadTypes.h"
 #include "AmigaTypes.h"
+#include "ProfilerTypes.h"
 
 // namespace vamiga {
 
@@ -457,6 +458,10 @@ typedef struct
     double cpuLoad;         ///< Measured CPU load
     double fps;             ///< Measured frames per seconds
     isize resyncs;          ///< Number of out-of-sync conditions
+    isize msgDropped;       ///< Number of messages lost due to a full queue
+    isize msgCoalesced;     ///< Number of skipped duplicate messages
+    isize cmdDropped;       ///< Number of commands lost due to a full queue
+    ProfilerStats profiler; ///< Host time spent in the emulator components
 }
 EmulatorStats;
 
@@ -97,7 +97,7 @@ Memory::_dump(Category category, std::ostream& os) const
 void
 Memory::_initialize()
 {    
-    if (auto romPath = Emulator::defaults.getRaw("ROM_PATH"); romPath != "") {
+    if (auto romPath = emulator.defaults.getRaw("ROM_PATH"); romPath != "") {
 
         debug(CNF_DEBUG, "Trying to load Rom from %s...\n", romPath.c_str());
         
@@ -106,7 +106,7 @@ Memory::_initialize()
         }
     }
     
-    if (auto extPath = Emulator::defaults.getRaw("EXT_PATH"); extPath != "") {
+    if (auto extPath = emulator.defaults.getRaw("EXT_PATH"); extPath != "") {
 
         debug(CNF_DEBUG, "Trying to load extension Rom from %s...\n", extPath.c_str());
         
@@ -304,6 +304,13 @@ Memory::_didReset(bool hard)
     clearStats();
 }
 
+void
+Memory::_didLoad()
+{
+    // Host pointers have changed (memory has been reallocated)
+    updateCpuPageTable();
+}
+
 void
 Memory::operator << (SerChecker &worker)
 {
@@ -611,14 +618,12 @@ Memory::fillRamWithInitPattern()
 }
 
 RomTraits &
-Memory::getRomTraits(u32 crc)
+Memory::getRomTraits(u32 crc) const
 {
-    static RomTraits fallback;
-
     // Crawl through the Rom database
     for (auto &traits : roms) if (traits.crc == crc) return traits;
 
-    fallback = RomTraits {
+    unknownRom = RomTraits {
 
         .crc = crc,
         .title = crc ? "Unknown ROM" : "",
@@ -628,7 +633,7 @@ Memory::getRomTraits(u32 crc)
         .vendor = ROM_VENDOR_OTHER
     };
 
-    return fallback;
+    return unknownRom;
 }
 
 RomTraits &
@@ -949,9 +954,74 @@ Memory::updateCpuMemSrcTable()
     // Expansion boards
     zorro.updateMemSrcTables();
 
+    // Update the direct access table
+    updateCpuPageTable();
+
     msgQueue.put(MSG_MEM_LAYOUT);
 }
 
+void
+Memory::updateCpuPageTable()
+{
+    // Fast Ram is mapped to a contiguous range of banks
+    isize firstFastPage = -1;
+
+    for (isize i = 0; i <= 0xFF; i++) {
+
+        auto &page = cpuPages[i];
+        auto addr = u32(i << 16);
+
+        page = { };
+
+        switch (cpuMemSrc[i]) {
+
+            case MEM_FAST:
+
+                if (firstFastPage < 0) firstFastPage = i;
+
+                if (fast && (i - firstFastPage) * 0x10000 < config.fastSize) {
+
+                    page.read = page.write = fast + (i - firstFastPage) * 0x10000;
+                    page.reads = &stats.fastReads.raw;
+                    page.writes = &stats.fastWrites.raw;
+                }
+                break;
+
+            case MEM_ROM:
+            case MEM_ROM_MIRROR:
+
+                // Small Roms (e.g., the A1000 Boot Rom) are mirrored inside a bank
+                if (rom && romMask >= 0xFFFF) {
+
+                    page.read = rom + (addr & romMask);
+                    page.reads = &stats.kickReads.raw;
+                }
+                break;
+
+            case MEM_WOM:
+
+                if (wom && womMask >= 0xFFFF) {
+
+                    page.read = wom + (addr & womMask);
+                    page.reads = &stats.kickReads.raw;
+                }
+                break;
+
+            case MEM_EXT:
+
+                if (ext && extMask >= 0xFFFF) {
+
+                    page.read = ext + (addr & extMask);
+                    page.reads = &stats.kickReads.raw;
+                }
+                break;
+
+            default:
+                break;
+        }
+    }
+}
+
 void
 Memory::updateAgnusMemSrcTable()
 {
@@ -1100,7 +1170,7 @@ Memory::peek8 <ACCESSOR_CPU, MEM_CHIP> (u32 addr)
     ASSERT_CHIP_ADDR(addr);
     agnus.executeUntilBusIsFree();
     
-    stats.chipReads.raw++;
+    if (MEM_STATS) stats.chipReads.raw++;
     dataBus = READ_CHIP_8(addr);
     return (u8)dataBus;
 }
@@ -1111,7 +1181,7 @@ Memory::peek16 <ACCESSOR_CPU, MEM_CHIP> (u32 addr)
     ASSERT_CHIP_ADDR(addr);
     agnus.executeUntilBusIsFree();
     
-    stats.chipReads.raw++;
+    if (MEM_STATS) stats.chipReads.raw++;
     dataBus = READ_CHIP_16(addr);
     return dataBus;
 }
@@ -1128,7 +1198,7 @@ Memory::peek8 <ACCESSOR_CPU, MEM_SLOW> (u32 addr)
     ASSERT_SLOW_ADDR(addr);
     agnus.executeUntilBusIsFree();
     
-    stats.slowReads.raw++;
+    if (MEM_STATS) stats.slowReads.raw++;
     dataBus = READ_SLOW_8(addr);
     return (u8)dataBus;
 }
@@ -1139,7 +1209,7 @@ Memory::peek16 <ACCESSOR_CPU, MEM_SLOW> (u32 addr)
     ASSERT_SLOW_ADDR(addr);
     agnus.executeUntilBusIsFree();
     
-    stats.slowReads.raw++;
+    if (MEM_STATS) stats.slowReads.raw++;
     dataBus = READ_SLOW_16(addr);
     return dataBus;
 }
@@ -1155,7 +1225,7 @@ Memory::peek8 <ACCESSOR_CPU, MEM_FAST> (u32 addr)
 {
     ASSERT_FAST_ADDR(addr);
     
-    stats.fastReads.raw++;
+    if (MEM_STATS) stats.fastReads.raw++;
     return READ_FAST_8(addr);
 }
 
@@ -1168,7 +1238,7 @@ Memory::peek16 <ACCESSOR_CPU, MEM_FAST> (u32 addr)
     
     ASSERT_FAST_ADDR(addr);
     
-    stats.fastReads.raw++;
+    if (MEM_STATS) stats.fastReads.raw++;
     return READ_FAST_16(addr);
 }
 
@@ -1331,7 +1401,7 @@ Memory::peek8 <ACCESSOR_CPU, MEM_ROM> (u32 addr)
 {
     ASSERT_ROM_ADDR(addr);
     
-    stats.kickReads.raw++;
+    if (MEM_STATS) stats.kickReads.raw++;
     return READ_ROM_8(addr);
 }
 
@@ -1340,7 +1410,7 @@ Memory::peek16 <ACCESSOR_CPU, MEM_ROM> (u32 addr)
 {
     ASSERT_ROM_ADDR(addr);
     
-    stats.kickReads.raw++;
+    if (MEM_STATS) stats.kickReads.raw++;
     return READ_ROM_16(addr);
 }
 
@@ -1355,7 +1425,7 @@ Memory::peek8 <ACCESSOR_CPU, MEM_WOM> (u32 addr)
 {
     ASSERT_WOM_ADDR(addr);
     
-    stats.kickReads.raw++;
+    if (MEM_STATS) stats.kickReads.raw++;
     return READ_WOM_8(addr);
 }
 
@@ -1364,7 +1434,7 @@ Memory::peek16 <ACCESSOR_CPU, MEM_WOM> (u32 addr)
 {
     ASSERT_WOM_ADDR(addr);
     
-    stats.kickReads.raw++;
+    if (MEM_STATS) stats.kickReads.raw++;
     return READ_WOM_16(addr);
 }
 
@@ -1379,7 +1449,7 @@ Memory::peek8 <ACCESSOR_CPU, MEM_EXT> (u32 addr)
 {
     ASSERT_EXT_ADDR(addr);
     
-    stats.kickReads.raw++;
+    if (MEM_STATS) stats.kickReads.raw++;
     return READ_EXT_8(addr);
 }
 
@@ -1388,7 +1458,7 @@ Memory::peek16 <ACCESSOR_CPU, MEM_EXT> (u32 addr)
 {
     ASSERT_EXT_ADDR(addr);
     
-    stats.kickReads.raw++;
+    if (MEM_STATS) stats.kickReads.raw++;
     return READ_EXT_16(addr);
 }
 
@@ -1511,6 +1581,28 @@ Memory::spypeek <ACCESSOR_CPU> (u32 addr, isize len, u8 *buf) const
     }
 }
 
+const u8 *
+Memory::spyPtr(u32 addr, isize len) const
+{
+    addr &= 0xFFFFFF;
+
+    // The range must not cross a bank boundary
+    if ((addr & 0xFFFF) + len > 0x10000) return nullptr;
+
+    switch (cpuMemSrc[addr >> 16]) {
+
+        case MEM_CHIP:
+        case MEM_CHIP_MIRROR:   return chip + (addr & chipMask);
+        case MEM_SLOW:          return slow + (addr - SLOW_RAM_STRT);
+
+        default:
+
+            // Fast Ram and Roms are covered by the direct access table
+            if (auto p = cpuPages[addr >> 16].read) return p + (addr & 0xFFFF);
+            return nullptr;
+    }
+}
+
 
 //
 // Peek (Agnus)
@@ -1631,7 +1723,7 @@ Memory::poke8 <ACCESSOR_CPU, MEM_CHIP> (u32 addr, u8 value)
 
     agnus.executeUntilBusIsFree();
     
-    stats.chipWrites.raw++;
+    if (MEM_STATS) stats.chipWrites.raw++;
     dataBus = value;
     WRITE_CHIP_8(addr, value);
 }
@@ -1649,7 +1741,7 @@ Memory::poke16 <ACCESSOR_CPU, MEM_CHIP> (u32 addr, u16 value)
 
     agnus.executeUntilBusIsFree();
     
-    stats.chipWrites.raw++;
+    if (MEM_STATS) stats.chipWrites.raw++;
     dataBus = value;
     WRITE_CHIP_16(addr, value);
 }
@@ -1661,7 +1753,7 @@ Memory::poke8 <ACCESSOR_CPU, MEM_SLOW> (u32 addr, u8 value)
     
     agnus.executeUntilBusIsFree();
     
-    stats.slowWrites.raw++;
+    if (MEM_STATS) stats.slowWrites.raw++;
     dataBus = value;
     WRITE_SLOW_8(addr, value);
 }
@@ -1673,7 +1765,7 @@ Memory::poke16 <ACCESSOR_CPU, MEM_SLOW> (u32 addr, u16 value)
     
     agnus.executeUntilBusIsFree();
     
-    stats.slowWrites.raw++;
+    if (MEM_STATS) stats.slowWrites.raw++;
     dataBus = value;
     WRITE_SLOW_16(addr, value);
 }
@@ -1683,7 +1775,7 @@ Memory::poke8 <ACCESSOR_CPU, MEM_FAST> (u32 addr, u8 value)
 {
     ASSERT_FAST_ADDR(addr);
     
-    stats.fastWrites.raw++;
+    if (MEM_STATS) stats.fastWrites.raw++;
     WRITE_FAST_8(addr, value);
 }
 
@@ -1692,7 +1784,7 @@ Memory::poke16 <ACCESSOR_CPU, MEM_FAST> (u32 addr, u16 value)
 {
     ASSERT_FAST_ADDR(addr);
     
-    stats.fastWrites.raw++;
+    if (MEM_STATS) stats.fastWrites.raw++;
     WRITE_FAST_16(addr, value);
 }
 
@@ -1802,7 +1894,7 @@ Memory::poke8 <ACCESSOR_CPU, MEM_ROM> (u32 addr, u8 value)
 {
     ASSERT_ROM_ADDR(addr);
     
-    stats.kickWrites.raw++;
+    if (MEM_STATS) stats.kickWrites.raw++;
     
     // On Amigas with a WOM, writing into ROM space locks the WOM
     if (hasWom() && !womIsLocked) {
@@ -1823,7 +1915,7 @@ Memory::poke8 <ACCESSOR_CPU, MEM_WOM> (u32 addr, u8 value)
 {
     ASSERT_WOM_ADDR(addr);
     
-    stats.kickWrites.raw++;
+    if (MEM_STATS) stats.kickWrites.raw++;
     if (!womIsLocked) WRITE_WOM_8(addr, value);
 }
 
@@ -1832,7 +1924,7 @@ Memory::poke16 <ACCESSOR_CPU, MEM_WOM> (u32 addr, u16 value)
 {
     ASSERT_WOM_ADDR(addr);
 
-    stats.kickWrites.raw++;
+    if (MEM_STATS) stats.kickWrites.raw++;
     if (!womIsLocked) WRITE_WOM_16(addr, value);
 }
 
@@ -1840,14 +1932,14 @@ template <> void
 Memory::poke8 <ACCESSOR_CPU, MEM_EXT> (u32 addr, u8 value)
 {
     ASSERT_EXT_ADDR(addr);
-    stats.kickWrites.raw++;
+    if (MEM_STATS) stats.kickWrites.raw++;
 }
 
 template <> void
 Memory::poke16 <ACCESSOR_CPU, MEM_EXT> (u32 addr, u16 value)
 {
     ASSERT_EXT_ADDR(addr);
-    stats.kickWrites.raw++;
+    if (MEM_STATS) stats.kickWrites.raw++;
 }
 
 template<> void
@@ -102,6 +102,18 @@ assert((x) >= 0xE80000 && (x) <= 0xE8FFFF);
 #define WRITE_EXT_16(x,y)   W16BE(ext + ((x) & extMask), (y))
 
 
+/* Host memory page as seen by the CPU. Banks which can be accessed without
+ * emulating the bus are backed by a pointer to host memory. The counters
+ * point to the statistical counters that are updated on each access.
+ */
+struct CpuPage {
+
+    u8 *read;
+    u8 *write;
+    isize *reads;
+    isize *writes;
+};
+
 class Memory final : public SubComponent, public Inspectable<MemInfo, MemStats> {
 
     Descriptions descriptions = {{
@@ -211,12 +223,22 @@ public:
     MemorySource cpuMemSrc[256];
     MemorySource agnusMemSrc[256];
 
+    /* Direct access table for the CPU. The table is derived from cpuMemSrc
+     * and has a non-null host pointer for all banks in Fast Ram, Rom, Wom, or
+     * Extended Rom. Accesses to all other banks require bus emulation.
+     * See also: updateCpuPageTable()
+     */
+    CpuPage cpuPages[256] = { };
+
     // The last value on the data bus
     u16 dataBus;
 
     // Static buffer for returning textual representations
     // TODO: Replace by "static string str" and make it local
     char str[256];
+
+    // Traits returned for Roms that are not in the database
+    mutable RomTraits unknownRom = { };
     
 
     //
@@ -247,7 +269,8 @@ public:
         CLONE(chipMask)
 
         CLONE(config)
-        
+
+        updateCpuPageTable();
         return *this;
     }
 
@@ -294,6 +317,7 @@ public:
     void operator << (SerReader &worker) override;
     void operator << (SerWriter &worker) override;
     void _didReset(bool hard) override;
+    void _didLoad() override;
     
 
     //
@@ -398,7 +422,7 @@ private:
 public:
 
     // Queries ROM information
-    static RomTraits &getRomTraits(u32 crc);
+    RomTraits &getRomTraits(u32 crc) const;
     RomTraits &getRomTraits() const;
     RomTraits &getWomTraits() const;
     RomTraits &getExtTraits() const;
@@ -467,6 +491,9 @@ private:
     void updateCpuMemSrcTable();
     void updateAgnusMemSrcTable();
 
+    // Updates the direct access table (called after cpuMemSrc has changed)
+    void updateCpuPageTable();
+
     // Checks whether Agnus is able to access Slow Ram
     bool slowRamIsMirroredIn() const;
 
@@ -489,11 +516,20 @@ public:
     template <Accessor acc> u32 spypeek32(u32 addr) const;
     template <Accessor acc> void spypeek(u32 addr, isize len, u8 *buf) const;
 
+    // Returns the host memory backing a range of Ram or Rom (or nullptr)
+    const u8 *spyPtr(u32 addr, isize len) const;
+
     template <Accessor acc, MemorySource src> void poke8(u32 addr, u8 value);
     template <Accessor acc, MemorySource src> void poke16(u32 addr, u16 value);
     template <Accessor acc> void poke8(u32 addr, u8 value);
     template <Accessor acc> void poke16(u32 addr, u16 value);
-    
+
+    // CPU accessors which bypass the memory source table if possible
+    u8 cpuPeek8(u32 addr);
+    u16 cpuPeek16(u32 addr);
+    void cpuPoke8(u32 addr, u8 value);
+    void cpuPoke16(u32 addr, u16 value);
+
 
     //
     // Accessing the CIA space
@@ -563,4 +599,50 @@ public:
     std::vector <u32> search(auto pattern) { return search(pattern, isizeof(pattern)); }
 };
 
+template<> u8 Memory::peek8 <ACCESSOR_CPU> (u32 addr);
+template<> u16 Memory::peek16 <ACCESSOR_CPU> (u32 addr);
+template<> void Memory::poke8 <ACCESSOR_CPU> (u32 addr, u8 value);
+template<> void Memory::poke16 <ACCESSOR_CPU> (u32 addr, u16 value);
+
+inline u8
+Memory::cpuPeek8(u32 addr)
+{
+    auto &page = cpuPages[(addr >> 16) & 0xFF];
+    if (!page.read) return peek8 <ACCESSOR_CPU> (addr);
+
+    if (MEM_STATS) (*page.reads)++;
+    return R8BE(page.read + (addr & 0xFFFF));
+}
+
+inline u16
+Memory::cpuPeek16(u32 addr)
+{
+    auto &page = cpuPages[(addr >> 16) & 0xFF];
+    if (!page.read) return peek16 <ACCESSOR_CPU> (addr);
+
+    if (MEM_STATS) (*page.reads)++;
+    return R16BE(page.read + (addr & 0xFFFF));
+}
+
+inline void
+Memory::cpuPoke8(u32 addr, u8 value)
+{
+    auto &page = cpuPages[(addr >> 16) & 0xFF];
+    if (!page.write) { poke8 <ACCESSOR_CPU> (addr, value); return; }
+
+    if (MEM_STATS) (*page.writes)++;
+    W8BE(page.write + (addr & 0xFFFF), value);
+}
+
+inline void
+Memory::cpuPoke16(u32 addr, u16 value)
+{
+    auto &page = cpuPages[(addr >> 16) & 0xFF];
+    if (!page.write) { poke16 <ACCESSOR_CPU> (addr, value); return; }
+
+    if (MEM_STATS) (*page.writes)++;
+    W16BE(page.write + (addr & 0xFFFF), value);
+}
+
+
 }
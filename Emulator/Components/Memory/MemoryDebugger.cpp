@@ -19,7 +19,7 @@ MemoryDebugger::ascDump(u32 addr, isize bytes) const
 {
     assert(bytes < 256);
 
-    static char str[256];
+    auto str = ascStr;
 
     for (isize i = 0; i < bytes; i += 2) {
 
@@ -37,7 +37,7 @@ MemoryDebugger::hexDump(u32 addr, isize bytes, isize sz) const
     assert(sz == 1 || bytes % 2 == 0);
     assert(bytes <= 64);
 
-    static char str[256];
+    auto str = hexStr;
     char *p = str;
 
     for (isize i = 0; i < bytes; i++) {
@@ -63,9 +63,8 @@ MemoryDebugger::memDump(u32 addr, isize bytes, isize sz) const
     assert(sz == 1 || bytes % 2 == 0);
     assert(bytes <= 32);
 
-    static string str;
-    str = string(hexDump<A>(addr, bytes, sz)) + "  " + string(ascDump<A>(addr, bytes));
-    return str.c_str();
+    memStr = string(hexDump<A>(addr, bytes, sz)) + "  " + string(ascDump<A>(addr, bytes));
+    return memStr.c_str();
 
     /*
      static char str[256];
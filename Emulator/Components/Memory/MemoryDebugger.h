@@ -33,6 +33,13 @@ public:
     // Last used address (current object location) (TODO: MOVE TO CALLER SIDE?!)
     u32 current = 0;
 
+private:
+
+    // Text buffers returned by ascDump(), hexDump(), and memDump()
+    mutable char ascStr[256];
+    mutable char hexStr[256];
+    mutable string memStr;
+
 
     //
     // Methods
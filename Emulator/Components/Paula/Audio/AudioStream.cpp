@@ -165,15 +165,13 @@ AudioStream::copyInterleaved(float *buffer, isize n)
 void 
 AudioStream::drawL(u32 *buffer, isize width, isize height, u32 color) const
 {
-    static float highest = 0.01f;
-    highest = drawL(buffer, width, height, highest, color);
+    highestL = drawL(buffer, width, height, highestL, color);
 }
 
 void
 AudioStream::drawR(u32 *buffer, isize width, isize height, u32 color) const
 {
-    static float highest = 0.01f;
-    highest = drawR(buffer, width, height, highest, color);
+    highestR = drawR(buffer, width, height, highestR, color);
 }
 
 float
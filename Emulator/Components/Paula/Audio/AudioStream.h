@@ -40,6 +40,10 @@ struct SamplePair
 
 class AudioStream : public CoreObject, public Synchronizable, public util::RingBuffer <SamplePair, 16384> {
 
+    // Highest amplitudes found by drawL() and drawR() (used for auto-scaling)
+    mutable float highestL = 0.01f;
+    mutable float highestR = 0.01f;
+
 public:
 
     const char *objectName() const override { return "AudioStream"; }
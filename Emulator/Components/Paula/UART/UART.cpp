@@ -145,6 +145,17 @@ UART::setSERPER(u16 value)
     trace(SER_DEBUG, "New baud rate = %ld\n", baudRate());
 }
 
+bool
+UART::fastPath() const
+{
+    auto &config = serialPort.getConfig();
+
+    // The loopback cable needs to see each bit on the TXD line
+    if (config.fastBaud == 0 || config.device == SPD_LOOPBACK) return false;
+
+    return baudRate() >= config.fastBaud;
+}
+
 void
 UART::copyToTransmitShiftRegister()
 {
@@ -166,6 +166,9 @@ private:
     // Returns true if the shift register is empty
     bool shiftRegEmpty() const { return transmitShiftReg == 0; }
 
+    // Checks whether whole bytes can be shifted out at once
+    bool fastPath() const;
+
     // Copies the contents of the transmit buffer to the transmit shift register
     void copyToTransmitShiftRegister();
 
@@ -11,7 +11,9 @@
 #include "UART.h"
 #include "Agnus.h"
 #include "Paula.h"
+#include "RemoteManager.h"
 #include "SerialPort.h"
+#include <bit>
 
 namespace vamiga {
 
@@ -38,9 +40,25 @@ UART::serviceTxdEvent(EventID id)
                     // Abort the transmission
                     trace(SER_DEBUG, "All packets sent\n");
                     agnus.cancel<SLOT_TXD>();
+
+                    // Hand over pending bytes to the null modem cable
+                    remoteManager.serServer.flush();
                     break;
                 }
 
+            } else if (fastPath()) {
+
+                // Shift out all remaining bits at once
+                trace(SER_DEBUG, "Transmitting packet\n");
+                transmitShiftReg = 0;
+
+                if (transmitBuffer) {
+
+                    // Copy next packet into shift register
+                    trace(SER_DEBUG, "Transmitting next packet %x\n", transmitBuffer);
+                    copyToTransmitShiftRegister();
+                }
+
             } else {
 
                 // Run the shift register
@@ -59,8 +77,16 @@ UART::serviceTxdEvent(EventID id)
             outBit = transmitShiftReg & 1;
             updateTXD();
 
-            // Schedule next event
-            agnus.scheduleRel<SLOT_TXD>(pulseWidth(), TXD_BIT);
+            /* Schedule next event. In fast path mode, the event is scheduled
+             * at the cycle where the last bit would have been shifted out.
+             * Hence, the shift register empties at the same cycle as in
+             * bit-by-bit mode.
+             */
+            if (transmitShiftReg && fastPath()) {
+                agnus.scheduleRel<SLOT_TXD>(std::bit_width(transmitShiftReg) * pulseWidth(), TXD_BIT);
+            } else {
+                agnus.scheduleRel<SLOT_TXD>(pulseWidth(), TXD_BIT);
+            }
             break;
 
         default:
@@ -167,7 +167,7 @@ ControlPort::processCommand(const Cmd &cmd)
 
         case CMD_MOUSE_MOVE_ABS:    mouse.setXY(cmd.coord.x, cmd.coord.y); break;
         case CMD_MOUSE_MOVE_REL:    mouse.setDxDy(cmd.coord.x, cmd.coord.y); break;
-        case CMD_MOUSE_EVENT:       mouse.trigger(cmd.action.action); break;
+        case CMD_MOUSE_EVENT:       mouse.trigger(cmd.action.action, cmd.action.delay); break;
         case CMD_JOY_EVENT:         joystick.trigger(cmd.action.action); break;
 
         default:
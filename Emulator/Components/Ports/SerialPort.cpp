@@ -21,6 +21,8 @@ SerialPort::getOption(Option option) const
             
         case OPT_SER_DEVICE:    return (i64)config.device;
         case OPT_SER_VERBOSE:   return (i64)config.verbose;
+        case OPT_SER_BULK:      return (i64)config.bulk;
+        case OPT_SER_FAST_BAUD: return (i64)config.fastBaud;
 
         default:
             fatalError;
@@ -40,9 +42,17 @@ SerialPort::checkOption(Option opt, i64 value)
             return;
 
         case OPT_SER_VERBOSE:
+        case OPT_SER_BULK:
 
             return;
 
+        case OPT_SER_FAST_BAUD:
+
+            if (value < 0) {
+                throw Error(VAERROR_OPT_INV_ARG, "0 ... " + std::to_string(CLK_FREQUENCY_PAL));
+            }
+            return;
+
         default:
             throw(VAERROR_OPT_UNSUPPORTED);
     }
@@ -67,6 +77,16 @@ SerialPort::setOption(Option option, i64 value)
             config.verbose = bool(value);
             return;
 
+        case OPT_SER_BULK:
+
+            config.bulk = bool(value);
+            return;
+
+        case OPT_SER_FAST_BAUD:
+
+            config.fastBaud = isize(value);
+            return;
+
         default:
             fatalError;
     }
@@ -182,9 +202,7 @@ SerialPort::readIncoming()
 {
     {   SYNCHRONIZED
 
-        auto result = incoming;
-        incoming.clear();
-        return result;
+        return drain(incoming);
     }
 }
 
@@ -193,9 +211,7 @@ SerialPort::readOutgoing()
 {
     {   SYNCHRONIZED
 
-        auto result = outgoing;
-        outgoing.clear();
-        return result;
+        return drain(outgoing);
     }
 }
 
@@ -204,11 +220,7 @@ SerialPort::readIncomingByte()
 {
     {   SYNCHRONIZED
 
-        if (incoming.empty()) return -1;
-
-        int result = incoming[0];
-        incoming.erase(incoming.begin());
-        return result;
+        return incoming.isEmpty() ? -1 : incoming.read();
     }
 }
 
@@ -217,11 +229,7 @@ SerialPort::readOutgoingByte()
 {
     {   SYNCHRONIZED
 
-        if (outgoing.empty()) return -1;
-
-        int result = outgoing[0];
-        outgoing.erase(outgoing.begin());
-        return result;
+        return outgoing.isEmpty() ? -1 : outgoing.read();
     }
 }
 
@@ -271,10 +279,10 @@ SerialPort::recordIncomingByte(int byte)
         trace(SER_DEBUG, "Incoming: %02X ('%c')\n", byte, isprint(byte) ? char(byte) : '?');
 
         // Record the incoming byte
-        incoming += char(byte);
+        capture(incoming, byte);
 
         // Inform the GUI if the record buffer had been empty
-        if (incoming.length() == 1) msgQueue.put(MSG_SER_IN);
+        if (incoming.count() == 1) msgQueue.put(MSG_SER_IN);
 
         // Inform RetroShell
         if (config.verbose) dumpByte(byte);
@@ -288,17 +296,35 @@ SerialPort::recordOutgoingByte(int byte)
 
         trace(SER_DEBUG, "Outgoing: %02X ('%c')\n", byte, isprint(byte) ? char(byte) : '?');
 
-        // Record the incoming byte
-        outgoing += char(byte);
+        // Record the outgoing byte
+        capture(outgoing, byte);
 
         // Inform the GUI if the record buffer had been empty
-        if (outgoing.length() == 1) msgQueue.put(MSG_SER_OUT);
+        if (outgoing.count() == 1) msgQueue.put(MSG_SER_OUT);
 
         // Inform RetroShell
         if (config.device == SPD_RETROSHELL || config.device == SPD_COMMANDER) dumpByte(byte);
     }
 }
 
+void
+SerialPort::capture(util::RingBuffer <u8, 0x10000> &buffer, int byte)
+{
+    // Make room by dropping the oldest byte if the buffer is full
+    if (buffer.isFull()) buffer.skip();
+    buffer.write(u8(byte));
+}
+
+std::u16string
+SerialPort::drain(util::RingBuffer <u8, 0x10000> &buffer)
+{
+    std::u16string result;
+    result.reserve(buffer.count());
+
+    while (!buffer.isEmpty()) result += char16_t(buffer.read());
+    return result;
+}
+
 void
 SerialPort::dumpByte(int byte)
 {
@@ -11,6 +11,7 @@
 
 #include "SerialPortTypes.h"
 #include "SubComponent.h"
+#include "RingBuffer.h"
 
 namespace vamiga {
 
@@ -36,7 +37,9 @@ class SerialPort final : public SubComponent, public Inspectable<SerialPortInfo>
     ConfigOptions options = {
 
         OPT_SER_DEVICE,
-        OPT_SER_VERBOSE
+        OPT_SER_VERBOSE,
+        OPT_SER_BULK,
+        OPT_SER_FAST_BAUD
     };
 
     friend class UART;
@@ -47,9 +50,9 @@ class SerialPort final : public SubComponent, public Inspectable<SerialPortInfo>
     // The current values of the port pins
     u32 port = 0;
 
-    // Temporary storage for incoming and outgoing bytes
-    std::u16string incoming;
-    std::u16string outgoing;
+    // Capture buffers for incoming and outgoing bytes (oldest bytes are dropped)
+    util::RingBuffer <u8, 0x10000> incoming;
+    util::RingBuffer <u8, 0x10000> outgoing;
 
 
     //
@@ -190,6 +193,12 @@ private:
     void recordIncomingByte(int byte);
     void recordOutgoingByte(int byte);
 
+    // Appends a byte to a capture buffer
+    void capture(util::RingBuffer <u8, 0x10000> &buffer, int byte);
+
+    // Removes and returns all bytes from a capture buffer
+    std::u16string drain(util::RingBuffer <u8, 0x10000> &buffer);
+
     // Dumps a byte to RetroShell
     void dumpByte(int byte);
 };
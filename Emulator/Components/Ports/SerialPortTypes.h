@@ -56,6 +56,12 @@ typedef struct
 {
     SerialPortDevice device;
     bool verbose;
+
+    // Batch outgoing bytes before handing them to the null modem socket
+    bool bulk;
+
+    // Minimum baud rate for shifting out whole bytes at once (0 = never)
+    isize fastBaud;
 }
 SerialPortConfig;
 
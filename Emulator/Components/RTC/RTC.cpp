@@ -129,7 +129,7 @@ RTC::getTime()
          * out of the host machine's current time and variable timeDiff.
          */
         lastMeasure = master;
-        lastMeasuredValue = (i64)time(nullptr);
+        lastMeasuredValue = hostTime();
         result = (time_t)lastMeasuredValue + (time_t)timeDiff;
 
     } else {
@@ -154,7 +154,18 @@ RTC::getTime()
 void
 RTC::setTime(time_t t)
 {
-    timeDiff = (i64)(t - time(nullptr));
+    timeDiff = (i64)t - hostTime();
+}
+
+i64
+RTC::hostTime() const
+{
+    auto &recorder = amiga.inputRecorder;
+
+    // Don't let the host clock interfere with a recorded or replayed movie
+    if (recorder.isRecording() || recorder.isReplaying()) return recorder.hostTime();
+
+    return (i64)time(nullptr);
 }
 
 void
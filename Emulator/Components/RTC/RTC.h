@@ -148,6 +148,11 @@ public:
     
     // Sets the current value of the real-time clock
     void setTime(time_t t);
+
+private:
+
+    // Returns the current time of the host machine
+    i64 hostTime() const;
     
     
     //
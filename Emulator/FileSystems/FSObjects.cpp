@@ -76,6 +76,14 @@ FSString::hashValue() const
     return result;
 }
 
+string
+FSString::normalized() const
+{
+    string result = str;
+    for (auto &c : result) c = capital(c);
+    return result;
+}
+
 void
 FSString::write(u8 *p)
 {
@@ -32,6 +32,9 @@ struct FSString {
     
     bool operator== (FSString &rhs) const;
     u32 hashValue() const;
+
+    // Returns the string in the case-insensitive form used for comparisons
+    string normalized() const;
     
     void write(u8 *p);
 };
@@ -507,19 +507,13 @@ string
 FileSystem::getPath(FSBlock *block)
 {
     string result = "";
-    std::set<Block> visited;
 
-    while(block) {
+    // A path can't be longer than the number of blocks without being cyclic
+    for (isize steps = 0; block && steps < numBlocks(); steps++) {
 
         // Break the loop if this block has an invalid type
         if (!hashableBlockPtr(block->nr)) break;
 
-        // Break the loop if this block was visited before
-        if (visited.find(block->nr) != visited.end()) break;
-        
-        // Add the block to the set of visited blocks
-        visited.insert(block->nr);
-
         // Expand the path
         string name = block->getName().c_str();
         result = (result == "") ? name : name + "/" + result;
@@ -534,31 +528,49 @@ FileSystem::getPath(FSBlock *block)
 Block
 FileSystem::seekRef(FSName name)
 {
-    std::set<Block> visited;
-    
     // Only proceed if a hash table is present
     FSBlock *cdb = currentDirBlock();
     if (!cdb || cdb->hashTableSize() == 0) return 0;
-    
-    // Compute the table position and read the item
-    u32 hash = name.hashValue() % cdb->hashTableSize();
-    u32 ref = cdb->getHashRef(hash);
-    
-    // Traverse the linked list until the item has been found
-    while (ref && visited.find(ref) == visited.end())  {
-        
-        FSBlock *item = hashableBlockPtr(ref);
-        if (item == nullptr) break;
-        
-        if (item->isNamed(name)) return item->nr;
 
-        visited.insert(ref);
-        ref = item->getNextHashRef();
-    }
+    // Lookup the item in the directory index
+    auto &index = indexDirectory(cdb);
+    if (auto it = index.find(name.normalized()); it != index.end()) return it->second;
 
     return 0;
 }
 
+const std::unordered_map<string, Block> &
+FileSystem::indexDirectory(FSBlock *dir)
+{
+    assert(dir);
+
+    // Check if the directory has been indexed already
+    if (auto it = dirIndex.find(dir->nr); it != dirIndex.end()) return it->second;
+
+    auto &index = dirIndex[dir->nr];
+    auto size = dir->hashTableSize();
+    for (isize hash = 0; hash < size; hash++) {
+
+        // Traverse the linked list (stop if a block has been visited before)
+        std::set<Block> visited;
+        FSBlock *item = hashableBlockPtr(dir->getHashRef(u32(hash)));
+        while (item && visited.insert(item->nr).second) {
+
+            /* Only record items in the bucket they belong to. Misplaced items
+             * are unreachable on a real Amiga, too. If a name appears twice,
+             * the first item in the chain wins.
+             */
+            FSName name = item->getName();
+            if (isize(name.hashValue()) % size == hash) index.try_emplace(name.normalized(), item->nr);
+
+            item = item->getNextHashBlock();
+        }
+    }
+
+    debug(FS_DEBUG, "Indexed directory %d (%zu items)\n", dir->nr, index.size());
+    return index;
+}
+
 void
 FileSystem::collect(Block nr, std::vector<Block> &result, bool recursive) const
 {
@@ -625,14 +637,12 @@ FileSystem::lastFileListBlockInChain(Block start)
 FSBlock *
 FileSystem::lastFileListBlockInChain(FSBlock *block)
 {
-    std::set<Block> visited;
-
-    while (block && visited.find(block->nr) == visited.end()) {
+    // A chain can't be longer than the number of blocks without being cyclic
+    for (isize steps = 0; block && steps < numBlocks(); steps++) {
 
         FSBlock *next = block->getNextListBlock();
         if (next == nullptr) return block;
 
-        visited.insert(block->nr);
         block = next;
     }
     return nullptr;
@@ -648,15 +658,13 @@ FileSystem::lastHashBlockInChain(Block start)
 FSBlock *
 FileSystem::lastHashBlockInChain(FSBlock *block)
 {
-    std::set<Block> visited;
-
-    while (block && visited.find(block->nr) == visited.end()) {
+    // A chain can't be longer than the number of blocks without being cyclic
+    for (isize steps = 0; block && steps < numBlocks(); steps++) {
 
         FSBlock *next = block->getNextHashBlock();
         if (next == nullptr) return block;
 
-        visited.insert(block->nr);
-        block =next;
+        block = next;
     }
     return nullptr;
 }
@@ -832,11 +840,10 @@ FileSystem::predictBlockType(Block nr, const u8 *buffer)
 FSBlockType
 FileSystem::getDisplayType(isize column)
 {
-    static constexpr isize width = 1760;
-    
+    constexpr isize width = imageWidth;
+    auto &cache = displayTypeCache;
+
     assert(column >= 0 && column < width);
-    
-    static FSBlockType cache[width] = { };
 
     // Cache values when the type of the first column is requested
     if (column == 0) {
@@ -881,11 +888,10 @@ FileSystem::getDisplayType(isize column)
 FSBlockType
 FileSystem::diagnoseImageSlice(isize column)
 {
-    static constexpr isize width = 1760;
-    
+    constexpr isize width = imageWidth;
+    auto &cache = diagnoseCache;
+
     assert(column >= 0 && column < width);
-    
-    static i8 cache[width] = { };
 
     // Cache values when the type of the first column is requested
     if (column == 0) {
@@ -896,7 +902,7 @@ FileSystem::diagnoseImageSlice(isize column)
         // Compute values
         for (isize i = 0; i < numBlocks(); i++) {
 
-            auto pos = i * width / (numBlocks() - 1);
+            auto pos = i * (width - 1) / (numBlocks() - 1);
             if (blocks[i]->corrupted) {
                 cache[pos] = 2;
             } else if (blocks[i]->type == FS_UNKNOWN_BLOCK) {
@@ -17,6 +17,7 @@
 #include "HDFFile.h"
 #include <stack>
 #include <set>
+#include <unordered_map>
 
 namespace vamiga {
 
@@ -65,6 +66,18 @@ protected:
 
     // The currently selected directory (reference to FSDirBlock)
     Block cd = 0;
+
+    /* Directory index. For each directory block that has been searched via
+     * seekRef(), this map stores the directory items by their normalized
+     * names. The index is built lazily and must be invalidated whenever the
+     * hash table or a hash chain of a directory changes.
+     */
+    std::unordered_map<Block, std::unordered_map<string, Block>> dirIndex;
+
+    // Column caches of the layout image and the diagnose image
+    static constexpr isize imageWidth = 1760;
+    FSBlockType displayTypeCache[imageWidth] = { };
+    i8 diagnoseCache[imageWidth] = { };
     
     
     //
@@ -215,6 +228,15 @@ public:
     FSBlock *seek(const string &name) { return blockPtr(seekRef(name)); }
     FSBlock *seekDir(const string &name) { return userDirBlockPtr(seekRef(name)); }
     FSBlock *seekFile(const string &name) { return fileHeaderBlockPtr(seekRef(name)); }
+
+protected:
+
+    // Returns the name index of a directory block (builds it if necessary)
+    const std::unordered_map<string, Block> &indexDirectory(FSBlock *dir);
+
+    // Removes a single directory or all directories from the index
+    void invalidateIndex(Block dir) { dirIndex.erase(dir); }
+    void invalidateIndex() { dirIndex.clear(); }
     
     
     //
@@ -11,9 +11,12 @@
 #include "IOUtils.h"
 #include "MutableFileSystem.h"
 #include "MemUtils.h"
+#include <algorithm>
 #include <climits>
+#include <future>
 #include <set>
 #include <stack>
+#include <thread>
 
 namespace vamiga {
 
@@ -22,6 +25,7 @@ MutableFileSystem::init(isize capacity)
 {
     // Remove existing blocks (if any)
     for (auto &b : blocks) delete b;
+    invalidateIndex();
     
     // Resize and initialize the block storage
     blocks.reserve(capacity);
@@ -245,12 +249,64 @@ MutableFileSystem::allocateBlockBelow(Block nr)
     return 0;
 }
 
+bool
+MutableFileSystem::allocateBlocks(isize count, std::vector<Block> &result, Block hint)
+{
+    assert(count >= 0);
+    assert(isBlockNumber(hint));
+
+    result.clear();
+    if (count == 0) return true;
+
+    // Seeks a contiguous run of free blocks inside the specified range
+    auto seekRun = [&](isize first, isize last) {
+
+        for (isize i = first, len = 0; i < last; i++) {
+
+            len = blocks[i]->type == FS_EMPTY_BLOCK ? len + 1 : 0;
+            if (len == count) return i - count + 1;
+        }
+        return isize(-1);
+    };
+
+    // Search above the hint first and above the root block second
+    if (hint < rootBlock) hint = rootBlock;
+    isize first = seekRun(hint + 1, numBlocks());
+    if (first < 0 && hint != rootBlock) first = seekRun(rootBlock + 1, numBlocks());
+
+    if (first >= 0) {
+
+        for (isize i = 0; i < count; i++) result.push_back(Block(first + i));
+
+    } else {
+
+        // Fall back to scattered blocks in the order used by allocateBlock()
+        for (isize i = rootBlock + 1; i < numBlocks() && isize(result.size()) < count; i++) {
+            if (blocks[i]->type == FS_EMPTY_BLOCK) result.push_back(Block(i));
+        }
+        for (i64 i = (i64)rootBlock - 1; i >= 0 && isize(result.size()) < count; i--) {
+            if (blocks[i]->type == FS_EMPTY_BLOCK) result.push_back(Block(i));
+        }
+        if (isize(result.size()) < count) {
+
+            result.clear();
+            return false;
+        }
+    }
+
+    for (auto nr : result) markAsAllocated(nr);
+    return true;
+}
+
 void
 MutableFileSystem::deallocateBlock(Block nr)
 {
     assert(isBlockNumber(nr));
     assert(blocks[nr]);
-    
+
+    // Removing a directory item or a directory invalidates the index
+    if (hashableBlockPtr(nr)) invalidateIndex();
+
     delete blocks[nr];
     blocks[nr] = new FSBlock(*this, nr, FS_EMPTY_BLOCK);
     markAsFree(nr);
@@ -258,42 +314,60 @@ MutableFileSystem::deallocateBlock(Block nr)
 
 Block
 MutableFileSystem::addFileListBlock(Block head, Block prev)
+{
+    if (!blockPtr(prev)) return 0;
+
+    Block nr = allocateBlock();
+    return nr ? addFileListBlock(nr, head, prev) : 0;
+}
+
+Block
+MutableFileSystem::addFileListBlock(Block at, Block head, Block prev)
 {
     FSBlock *prevBlock = blockPtr(prev);
     if (!prevBlock) return 0;
+
+    assert(isBlockNumber(at) && blocks[at]->type == FS_EMPTY_BLOCK);
+
+    delete blocks[at];
+    blocks[at] = new FSBlock(*this, at, FS_FILELIST_BLOCK);
+    blocks[at]->setFileHeaderRef(head);
+    prevBlock->setNextListBlockRef(at);
     
-    Block nr = allocateBlock();
-    if (!nr) return 0;
-    
-    blocks[nr] = new FSBlock(*this, nr, FS_FILELIST_BLOCK);
-    blocks[nr]->setFileHeaderRef(head);
-    prevBlock->setNextListBlockRef(nr);
-    
-    return nr;
+    return at;
 }
 
 Block
 MutableFileSystem::addDataBlock(isize count, Block head, Block prev)
+{
+    if (!blockPtr(prev)) return 0;
+
+    Block nr = allocateBlock();
+    return nr ? addDataBlock(nr, count, head, prev) : 0;
+}
+
+Block
+MutableFileSystem::addDataBlock(Block at, isize count, Block head, Block prev)
 {
     FSBlock *prevBlock = blockPtr(prev);
     if (!prevBlock) return 0;
 
-    Block nr = allocateBlock();
-    if (!nr) return 0;
+    assert(isBlockNumber(at) && blocks[at]->type == FS_EMPTY_BLOCK);
 
     FSBlock *newBlock;
     if (isOFS()) {
-        newBlock = new FSBlock(*this, nr, FS_DATA_BLOCK_OFS);
+        newBlock = new FSBlock(*this, at, FS_DATA_BLOCK_OFS);
     } else {
-        newBlock = new FSBlock(*this, nr, FS_DATA_BLOCK_FFS);
+        newBlock = new FSBlock(*this, at, FS_DATA_BLOCK_FFS);
     }
     
-    blocks[nr] = newBlock;
+    delete blocks[at];
+    blocks[at] = newBlock;
     newBlock->setDataBlockNr((Block)count);
     newBlock->setFileHeaderRef(head);
-    prevBlock->setNextDataBlockRef(nr);
+    prevBlock->setNextDataBlockRef(at);
     
-    return nr;
+    return at;
 }
 
 FSBlock *
@@ -305,6 +379,7 @@ MutableFileSystem::newUserDirBlock(const string &name)
 
         block = new FSBlock(*this, nr, FS_USERDIR_BLOCK);
         block->setName(FSName(name));
+        delete blocks[nr];
         blocks[nr] = block;
     }
     
@@ -314,24 +389,45 @@ MutableFileSystem::newUserDirBlock(const string &name)
 FSBlock *
 MutableFileSystem::newFileHeaderBlock(const string &name)
 {
-    FSBlock *block = nullptr;
-    
-    if (Block nr = allocateBlock()) {
+    Block nr = allocateBlock();
+    return nr ? newFileHeaderBlock(nr, name) : nullptr;
+}
+
+FSBlock *
+MutableFileSystem::newFileHeaderBlock(Block at, const string &name)
+{
+    assert(isBlockNumber(at) && blocks[at]->type == FS_EMPTY_BLOCK);
+
+    FSBlock *block = new FSBlock(*this, at, FS_FILEHEADER_BLOCK);
+    block->setName(FSName(name));
+
+    delete blocks[at];
+    blocks[at] = block;
 
-        block = new FSBlock(*this, nr, FS_FILEHEADER_BLOCK);
-        block->setName(FSName(name));
-        blocks[nr] = block;
-    }
-    
     return block;
 }
 
 void
 MutableFileSystem::updateChecksums()
 {
-    for (isize i = 0; i < numBlocks(); i++) {
-        blocks[i]->updateChecksum();
+    // Small volumes are not worth the thread creation overhead
+    isize numThreads = std::clamp(isize(std::thread::hardware_concurrency()), isize(1), isize(8));
+    if (numBlocks() < 8192) numThreads = 1;
+
+    auto update = [this](isize first, isize last) {
+        for (isize i = first; i < last; i++) blocks[i]->updateChecksum();
+    };
+
+    if (numThreads == 1) { update(0, numBlocks()); return; }
+
+    // All blocks are independent, so we can split the volume into slices
+    std::vector<std::thread> workers;
+    isize slice = (numBlocks() + numThreads - 1) / numThreads;
+
+    for (isize i = 0; i < numBlocks(); i += slice) {
+        workers.emplace_back(update, i, std::min(numBlocks(), i + slice));
     }
+    for (auto &worker : workers) worker.join();
 }
 
 void
@@ -438,11 +534,22 @@ MutableFileSystem::addHashRef(FSBlock *newBlock)
     u32 ref = cdb->getHashRef(hash);
 
     // If the slot is empty, put the reference there
-    if (ref == 0) { cdb->setHashRef(hash, newBlock->nr); return; }
+    if (ref == 0) {
+
+        cdb->setHashRef(hash, newBlock->nr);
+
+    } else {
+
+        // Otherwise, put it into the last element of the block list chain
+        FSBlock *last = lastHashBlockInChain(ref);
+        if (!last) { invalidateIndex(cdb->nr); return; }
+        last->setNextHashRef(newBlock->nr);
+    }
 
-    // Otherwise, put it into the last element of the block list chain
-    FSBlock *last = lastHashBlockInChain(ref);
-    if (last) last->setNextHashRef(newBlock->nr);
+    // Keep the directory index up to date (the first item of a name wins)
+    if (auto it = dirIndex.find(cdb->nr); it != dirIndex.end()) {
+        it->second.try_emplace(newBlock->getName().normalized(), newBlock->nr);
+    }
 }
 
 isize
@@ -464,36 +571,14 @@ MutableFileSystem::addData(FSBlock &block, const u8 *buffer, isize size)
             debug(FS_DEBUG, "Required list blocks : %ld\n", numListBlocks);
             debug(FS_DEBUG, "         Free blocks : %ld\n", freeBlocks());
             
-            if (freeBlocks() < numDataBlocks + numListBlocks) {
+            // Allocate all blocks at once (preferably behind the header)
+            std::vector<Block> refs;
+            if (!allocateBlocks(numDataBlocks + numListBlocks, refs, nr)) {
                 warn("Not enough free blocks\n");
                 return 0;
             }
-            
-            for (Block ref = nr, i = 0; i < (Block)numListBlocks; i++) {
 
-                // Add a new file list block
-                ref = addFileListBlock(nr, ref);
-            }
-            
-            for (Block ref = nr, i = 1; i <= (Block)numDataBlocks; i++) {
-
-                // Add a new data block
-                ref = addDataBlock(i, nr, ref);
-
-                // Add references to the new data block
-                block.addDataBlockRef(ref, ref);
-                
-                // Add data
-                FSBlock *ptr = blockPtr(ref);
-                if (ptr) {
-                    isize written = addData(*ptr, buffer, size);
-                    block.setFileSize((u32)(block.getFileSize() + written));
-                    buffer += written;
-                    size -= written;
-                }
-            }
-
-            return block.getFileSize();
+            return addData(block, buffer, size, refs.data());
         }
         case FS_DATA_BLOCK_OFS:
         {
@@ -517,6 +602,44 @@ MutableFileSystem::addData(FSBlock &block, const u8 *buffer, isize size)
     }
 }
 
+isize
+MutableFileSystem::addData(FSBlock &block, const u8 *buffer, isize size, const Block *refs)
+{
+    assert(block.type == FS_FILEHEADER_BLOCK);
+    assert(block.getFileSize() == 0);
+    assert(refs);
+
+    auto nr = block.nr;
+    isize numDataBlocks = requiredDataBlocks(size);
+    isize numListBlocks = requiredFileListBlocks(size);
+
+    for (Block ref = nr, i = 0; i < (Block)numListBlocks; i++) {
+
+        // Add a new file list block
+        ref = addFileListBlock(*refs++, nr, ref);
+    }
+
+    for (Block ref = nr, i = 1; i <= (Block)numDataBlocks; i++) {
+
+        // Add a new data block
+        ref = addDataBlock(*refs++, i, nr, ref);
+
+        // Add references to the new data block
+        block.addDataBlockRef(ref, ref);
+
+        // Add data
+        FSBlock *ptr = blockPtr(ref);
+        if (ptr) {
+            isize written = addData(*ptr, buffer, size);
+            block.setFileSize((u32)(block.getFileSize() + written));
+            buffer += written;
+            size -= written;
+        }
+    }
+
+    return block.getFileSize();
+}
+
 void
 MutableFileSystem::importVolume(const u8 *src, isize size)
 {
@@ -533,6 +656,9 @@ MutableFileSystem::importVolume(const u8 *src, isize size)
     // Only proceed if all partitions contain a valid file system
     if (dos == FS_NODOS) throw Error(VAERROR_FS_UNSUPPORTED);
 
+    // Throw away the directory index
+    invalidateIndex();
+
     // Import all blocks
     for (isize i = 0; i < numBlocks(); i++) {
         
@@ -575,33 +701,106 @@ MutableFileSystem::importDirectory(const std::filesystem::path &path, bool recur
 void
 MutableFileSystem::importDirectory(const fs::directory_entry &dir, bool recursive)
 {
-    for (const auto& entry : fs::directory_iterator(dir)) {
-        
-        const auto path = entry.path().string();
-        const auto name = entry.path().filename().string();
+    struct Item { fs::path path; string name; isize parent; bool isDir; };
+    std::vector<Item> items;
 
-        // Skip all hidden files
-        if (name[0] == '.') continue;
+    // Collect all items such that each directory precedes its contents
+    auto scan = [&](auto &self, const fs::directory_entry &dir, isize parent) -> void {
 
-        debug(FS_DEBUG, "Importing %s\n", path.c_str());
+        for (const auto& entry : fs::directory_iterator(dir)) {
 
-        if (entry.is_directory()) {
-            
-            // Add directory
-            if(createDir(name) && recursive) {
+            auto name = entry.path().filename().string();
+
+            // Skip all hidden files
+            if (name[0] == '.') continue;
+
+            if (entry.is_directory()) {
 
-                changeDir(name);
-                importDirectory(entry, recursive);
+                items.push_back({ entry.path(), name, parent, true });
+                if (recursive) self(self, entry, isize(items.size()) - 1);
+            }
+            if (entry.is_regular_file()) {
+
+                items.push_back({ entry.path(), name, parent, false });
             }
         }
+    };
+    scan(scan, dir, -1);
+
+    // Read host files ahead on worker threads
+    using Data = std::unique_ptr<Buffer<u8>>;
+    std::vector<std::future<Data>> data(items.size());
+    isize window = std::clamp(isize(std::thread::hardware_concurrency()) * 2, isize(2), isize(32));
+    isize next = 0;
+
+    auto prefetch = [&](isize upTo) {
+
+        for (; next < isize(items.size()) && next < upTo; next++) {
+
+            if (items[next].isDir) continue;
+            data[next] = std::async(std::launch::async, [path = items[next].path]() {
+                return std::make_unique<Buffer<u8>>(path);
+            });
+        }
+    };
+
+    // Remember the directory block created for each item
+    std::vector<Block> dirs(items.size(), 0);
+    std::vector<Block> refs;
+    auto parent = cd;
+    Block hint = rootBlock;
+
+    try {
+
+        for (isize i = 0; i < isize(items.size()); i++) {
+
+            auto &item = items[i];
+            prefetch(i + window);
+
+            // Skip the item if its parent directory couldn't be created
+            cd = item.parent < 0 ? parent : dirs[item.parent];
+            if (!cd) continue;
+
+            debug(FS_DEBUG, "Importing %s\n", item.path.string().c_str());
+
+            if (item.isDir) {
+
+                // Add directory
+                if (auto *block = createDir(item.name)) dirs[i] = block->nr;
+                continue;
+            }
 
-        if (entry.is_regular_file()) {
-            
             // Add file
-            Buffer<u8> buffer(path);
-            if (buffer) createFile(name, buffer.ptr, buffer.size);
+            auto buffer = data[i].get();
+            if (buffer->empty()) continue;
+
+            auto size = buffer->size;
+            auto count = 1 + requiredFileListBlocks(size) + requiredDataBlocks(size);
+
+            if (allocateBlocks(count, refs, hint)) {
+
+                // Place the header, the list blocks, and the data blocks in a row
+                FSBlock *block = newFileHeaderBlock(refs[0], item.name);
+                block->setParentDirRef(cd);
+                addHashRef(block);
+                addData(*block, buffer->ptr, size, refs.data() + 1);
+                hint = refs.back();
+
+            } else {
+
+                // Let the standard code path handle the error
+                createFile(item.name, buffer->ptr, size);
+            }
         }
+
+    } catch (...) {
+
+        // Restore the working directory
+        cd = parent;
+        throw;
     }
+
+    cd = parent;
 }
 
 bool
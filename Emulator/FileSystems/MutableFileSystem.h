@@ -78,18 +78,27 @@ public:
     Block allocateBlockAbove(Block nr);
     Block allocateBlockBelow(Block nr);
 
+    /* Seeks free blocks and marks them as allocated. The function prefers a
+     * single contiguous run above the hint and falls back to scattered blocks
+     * if no such run exists. On failure, no block is allocated.
+     */
+    bool allocateBlocks(isize count, std::vector<Block> &result, Block hint = 0);
+
     // Deallocates a block
     void deallocateBlock(Block nr);
 
     // Adds a new block of a certain kind
     Block addFileListBlock(Block head, Block prev);
+    Block addFileListBlock(Block at, Block head, Block prev);
     Block addDataBlock(isize count, Block head, Block prev);
-    
+    Block addDataBlock(Block at, isize count, Block head, Block prev);
+
     // Creates a new block of a certain kind
     FSBlock *newUserDirBlock(const string &name);
     FSBlock *newFileHeaderBlock(const string &name);
-    
-    // Updates the checksums in all blocks
+    FSBlock *newFileHeaderBlock(Block at, const string &name);
+
+    // Updates the checksums in all blocks (in parallel for large volumes)
     void updateChecksums();
     
     
@@ -139,6 +148,9 @@ private:
 
     // Adds data bytes to a block
     isize addData(FSBlock &block, const u8 *buffer, isize size);
+
+    // Adds data bytes to a file header block using preallocated blocks
+    isize addData(FSBlock &block, const u8 *buffer, isize size, const Block *refs);
     
     
     //
@@ -150,7 +162,11 @@ public:
     // Imports the volume from a buffer compatible with the ADF format
     void importVolume(const u8 *src, isize size) throws;
 
-    // Imports a directory from the host file system
+    /* Imports a directory from the host file system. Host files are read
+     * ahead on worker threads while the blocks of the previous files are set
+     * up. Checksums are not computed by this function. Call updateChecksums()
+     * after the import has completed.
+     */
     void importDirectory(const std::filesystem::path &path, bool recursive = true) throws;
     void importDirectory(const fs::directory_entry &dir, bool recursive) throws;
     
@@ -11,10 +11,11 @@
 #include "config.h"
 #include "Headless.h"
 #include "HeadlessScripts.h"
-#include "Amiga.h"
+#include "Emulator.h"
 #include "Script.h"
 #include "DiagRom.h"
 #include <chrono>
+#include <future>
 
 int main(int argc, char *argv[])
 {
@@ -24,13 +25,18 @@ int main(int argc, char *argv[])
         
     } catch (vamiga::SyntaxError &e) {
         
-        std::cout << "Usage: vAmigaCore [-fsdvm] [<script>]" << std::endl;
+        std::cout << "Usage: vAmigaCore [-fsdpvm] [-c <dir>] [-r <movie>] [-g <file>] [-t <file>] [<script>]" << std::endl;
         std::cout << std::endl;
         std::cout << "       -f or --footprint   Reports the size of certain objects" << std::endl;
         std::cout << "       -s or --smoke       Runs some smoke tests to test the build" << std::endl;
         std::cout << "       -d or --diagnose    Run DiagRom in the background" << std::endl;
+        std::cout << "       -p or --parallel    Run many emulator instances concurrently" << std::endl;
         std::cout << "       -v or --verbose     Print executed script lines" << std::endl;
         std::cout << "       -m or --messages    Observe the message queue" << std::endl;
+        std::cout << "       -c or --cache <dir> Cache encoded floppy disks in this directory" << std::endl;
+        std::cout << "       -r or --replay <movie> Replay a movie file in warp mode" << std::endl;
+        std::cout << "       -g or --gprof <file> Write a guest code profile (collapsed stacks)" << std::endl;
+        std::cout << "       -t or --trace <file> Write a binary instruction trace (see vAmigaTrace)" << std::endl;
         std::cout << "       <script>            Execute this script instead of the default" << std::endl;
         std::cout << std::endl;
         
@@ -65,11 +71,16 @@ Headless::main(int argc, char *argv[])
     // Parse all command line arguments
     parseArguments(argc, argv);
 
+    // Enable the media cache if requested
+    if (keys.find("cache") != keys.end())       { VAmiga::setMediaCache(keys["cache"]); }
+
     // Check options
     if (keys.find("footprint") != keys.end())   { reportSize(); }
-    if (keys.find("smoke") != keys.end())       { runScript(smokeTestScript); }
+    if (keys.find("smoke") != keys.end())       { runScript(smokeTestScript); runMovieTest(); }
     if (keys.find("diagnose") != keys.end())    { runScript(selfTestScript); }
+    if (keys.find("parallel") != keys.end())    { runParallelTest(); }
     if (keys.find("arg1") != keys.end())        { runScript(keys["arg1"]); }
+    if (keys.find("replay") != keys.end())      { replayMovie(keys["replay"]); }
 
     return returnCode;
 }
@@ -90,9 +101,38 @@ Headless::parseArguments(int argc, char *argv[])
             if (arg == "-f" || arg == "--footprint") { keys["footprint"] = "1"; continue; }
             if (arg == "-s" || arg == "--smoke")     { keys["smoke"] = "1"; continue; }
             if (arg == "-d" || arg == "--diagnose")  { keys["diagnose"] = "1"; continue; }
+            if (arg == "-p" || arg == "--parallel")  { keys["parallel"] = "1"; continue; }
             if (arg == "-v" || arg == "--verbose")   { keys["verbose"] = "1"; continue; }
             if (arg == "-m" || arg == "--messages")  { keys["messages"] = "1"; continue; }
 
+            if (arg == "-c" || arg == "--cache") {
+
+                if (++i == argc) throw SyntaxError("Missing cache directory");
+                keys["cache"] = std::filesystem::absolute(argv[i]).string();
+                continue;
+            }
+
+            if (arg == "-r" || arg == "--replay") {
+
+                if (++i == argc) throw SyntaxError("Missing movie file");
+                keys["replay"] = std::filesystem::absolute(argv[i]).string();
+                continue;
+            }
+
+            if (arg == "-g" || arg == "--gprof") {
+
+                if (++i == argc) throw SyntaxError("Missing profile file");
+                keys["gprof"] = std::filesystem::absolute(argv[i]).string();
+                continue;
+            }
+
+            if (arg == "-t" || arg == "--trace") {
+
+                if (++i == argc) throw SyntaxError("Missing trace file");
+                keys["trace"] = std::filesystem::absolute(argv[i]).string();
+                continue;
+            }
+
             throw SyntaxError("Invalid option '" + arg + "'");
         }
 
@@ -116,6 +156,11 @@ Headless::checkArguments()
     if (keys.find("arg1") != keys.end() && !util::fileExists(keys["arg1"])) {
         throw SyntaxError("File " + keys["arg1"] + " does not exist");
     }
+
+    // The movie file must exist
+    if (keys.find("replay") != keys.end() && !util::fileExists(keys["replay"])) {
+        throw SyntaxError("File " + keys["replay"] + " does not exist");
+    }
 }
 
 void
@@ -148,10 +193,162 @@ Headless::runScript(const std::filesystem::path &path)
     // Launch the emulator thread
     vamiga.launch(this, vamiga::process);
 
+    // Profile guest code if requested
+    auto gprof = keys.find("gprof") != keys.end();
+    if (gprof) vamiga.amiga.startGuestProfiling();
+
+    // Trace instructions if requested
+    auto trace = keys.find("trace") != keys.end();
+    if (trace) vamiga.amiga.startTracing(keys["trace"], MB(256));
+
     // Execute script
     const auto timeout = util::Time::seconds(500.0);
     vamiga.retroShell.execScript(script);
     waitForWakeUp(timeout);
+
+    if (gprof) vamiga.amiga.saveGuestProfile(keys["gprof"]);
+    if (trace) vamiga.amiga.stopTracing();
+}
+
+void
+Headless::replayMovie(const std::filesystem::path &path)
+{
+    // Create an emulator instance
+    VAmiga vamiga;
+
+    // Plug in DiagRom (the movie overrides it if it contains a Rom)
+    vamiga.mem.loadRom(diagROM13, sizeofDiagRom13);
+
+    // Launch the emulator thread
+    vamiga.launch(this, vamiga::process);
+
+    // Revert to the initial state of the movie
+    vamiga.powerOn();
+    vamiga.amiga.replayMovie(path);
+
+    // Profile guest code if requested
+    auto gprof = keys.find("gprof") != keys.end();
+    if (gprof) vamiga.amiga.startGuestProfiling();
+
+    // Trace instructions if requested
+    auto trace = keys.find("trace") != keys.end();
+    if (trace) vamiga.amiga.startTracing(keys["trace"], MB(256));
+
+    // Run at full host speed until the movie ends
+    vamiga.set(OPT_AMIGA_WARP_MODE, WARP_ALWAYS);
+    auto first = vamiga.amiga.getInfo().frame;
+    auto start = util::Time::now();
+
+    const auto timeout = util::Time::seconds(3600.0);
+    vamiga.run();
+    waitForWakeUp(timeout);
+
+    vamiga.pause();
+    auto elapsed = (util::Time::now() - start).asSeconds();
+    auto frames = vamiga.amiga.getInfo().frame - first;
+
+    msg("  Input events : %ld\n", vamiga.amiga.recordedInputEvents());
+    msg("        Frames : %lld\n", (long long)frames);
+    msg("     Host time : %.2f sec (%.1f fps)\n", elapsed, elapsed > 0 ? frames / elapsed : 0);
+    msg("        Result : %s\n", returnCode ? "Diverged" : "Bit-exact");
+
+    if (gprof) vamiga.amiga.saveGuestProfile(keys["gprof"]);
+    if (trace) vamiga.amiga.stopTracing();
+}
+
+void
+Headless::runMovieTest()
+{
+    auto path = std::filesystem::temp_directory_path() / "smoke.vam";
+
+    {   // Create an emulator instance
+        VAmiga vamiga;
+        vamiga.mem.loadRom(diagROM13, sizeofDiagRom13);
+        vamiga.launch(this, vamiga::process);
+
+        // Record a session with some input events at arbitrary points in time
+        vamiga.powerOn();
+        vamiga.run();
+        vamiga.amiga.startInputRecording();
+
+        for (isize i = 0; i < 10; i++) {
+
+            util::Time::milliseconds(50).sleep();
+            vamiga.keyboard.press(KeyCode(0x40 + i), 0.0, 0.1);
+            vamiga.controlPort1.mouse.setDxDy(double(i), double(-i));
+            vamiga.controlPort1.mouse.trigger(i & 1 ? RELEASE_LEFT : PRESS_LEFT);
+            vamiga.controlPort2.joystick.trigger(i & 1 ? RELEASE_FIRE : PRESS_FIRE);
+        }
+        util::Time::milliseconds(50).sleep();
+
+        vamiga.pause();
+        vamiga.amiga.saveMovie(path);
+    }
+
+    // Replay the movie in warp mode
+    replayMovie(path);
+}
+
+void
+Headless::runParallelTest()
+{
+    constexpr isize instances = 16;
+    constexpr isize variants = 4;
+    constexpr isize frames = 100;
+
+    // Emulates a number of frames and records a checksum every 10 frames
+    auto emulate = [](isize variant) {
+
+        std::vector<u64> result;
+
+        // Create an emulator instance without launching its thread
+        VAmiga vamiga;
+        vamiga.mem.loadRom(diagROM13, sizeofDiagRom13);
+        vamiga.emu->initialize();
+
+        // Remove the default hard drive (its file system is time-stamped)
+        auto &amiga = vamiga.emu->main;
+        amiga.set(OPT_HDC_CONNECT, false, { 0 });
+
+        // Vary the memory configuration among the instances
+        amiga.set(OPT_MEM_CHIP_RAM, variant & 1 ? 1024 : 512);
+        amiga.set(OPT_MEM_SLOW_RAM, variant & 2 ? 512 : 0);
+
+        // Emulate the frames in the calling thread
+        amiga.powerOn();
+        for (isize i = 1; i <= frames; i++) {
+
+            amiga.computeFrame();
+            if (i % 10 == 0) result.push_back(amiga.checksum(true));
+        }
+        return result;
+    };
+
+    // Run all variants one after another
+    std::vector<std::vector<u64>> expected;
+    auto start = util::Time::now();
+    for (isize i = 0; i < variants; i++) expected.push_back(emulate(i));
+    auto serial = (util::Time::now() - start).asSeconds();
+
+    // Run all instances concurrently
+    std::vector<std::future<std::vector<u64>>> results;
+    start = util::Time::now();
+    for (isize i = 0; i < instances; i++) {
+        results.push_back(std::async(std::launch::async, emulate, i % variants));
+    }
+
+    isize mismatches = 0;
+    for (isize i = 0; i < instances; i++) {
+        if (results[i].get() != expected[i % variants]) mismatches++;
+    }
+    auto parallel = (util::Time::now() - start).asSeconds();
+
+    msg("     Instances : %ld (%ld frames each)\n", instances, frames);
+    msg("   Serial time : %.2f sec (%ld instances)\n", serial, variants);
+    msg(" Parallel time : %.2f sec (%ld instances)\n", parallel, instances);
+    msg("    Mismatches : %ld\n", mismatches);
+
+    if (mismatches) returnCode = 1;
 }
 
 void
@@ -185,6 +382,12 @@ Headless::process(Message msg)
             wakeUp();
             break;
 
+        case MSG_REPLAY_FINISHED:
+
+            if (!msg.value) returnCode = 1;
+            wakeUp();
+            break;
+
         default:
             break;
     }
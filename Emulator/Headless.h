@@ -52,6 +52,15 @@ private:
     void runScript(const char **script);
     void runScript(const std::filesystem::path &path);
 
+    // Replays a movie file and reports if the end state matches
+    void replayMovie(const std::filesystem::path &path);
+
+    // Records a movie, replays it, and checks the end state
+    void runMovieTest();
+
+    // Runs many emulator instances concurrently and compares their states
+    void runParallelTest();
+
     
     //
     // Running
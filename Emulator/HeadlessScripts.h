@@ -72,6 +72,13 @@ static const char *smokeTestScript[] = {
     "amiga init A500_PLUS_1MB",
     "amiga power off",
     "amiga reset",
+    "amiga set REWIND true",
+    "amiga set REWIND_KEYS 25",
+    "amiga set REWIND_SIZE 32",
+    "try amiga rewind 0",
+    "amiga set REWIND false",
+    "amiga movie record",
+    "amiga movie stop",
 
     "",
     "mem",
@@ -360,6 +367,11 @@ static const char *smokeTestScript[] = {
     "hd1 set PAN 50",
     "hd1 set STEP_VOLUME 50",
 
+    "profile on",
+    "profile",
+    "profile off",
+    "profile reset",
+
     "server",
     "server serial",
     "server serial set PORT 8000",
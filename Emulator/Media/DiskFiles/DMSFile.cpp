@@ -12,12 +12,37 @@
 #include "AmigaFile.h"
 
 extern "C" {
-unsigned short extractDMS(const unsigned char *in, size_t inSize,
-                          unsigned char **out, size_t *outSize, int verbose);
+unsigned short scanDMS(const unsigned char *in, size_t inSize, size_t *outSize);
+unsigned short openDMS(const unsigned char *in, size_t inSize);
+unsigned short unpackNextDMSTrack(const unsigned char **out, size_t *outSize);
+void closeDMS(void);
+size_t sizeofDMSState(void);
+void saveDMS(unsigned char *state);
+unsigned short restoreDMS(const unsigned char *in, size_t inSize, const unsigned char *state);
 }
 
 namespace vamiga {
 
+// xDMS keeps its decoder state in global variables
+static std::mutex xdmsMutex;
+
+// The archive that is currently opened by xDMS (if any)
+static const DMSFile *xdmsOwner = nullptr;
+
+DMSFile::~DMSFile()
+{
+    // Stop the background decoder
+    {   std::lock_guard<std::mutex> guard(mutex);
+        cancel = true;
+    }
+    wakeup.notify_all();
+    if (worker.joinable()) worker.join();
+
+    // Release the decoder
+    std::lock_guard<std::mutex> guard(xdmsMutex);
+    if (xdmsOwner == this) { closeDMS(); xdmsOwner = nullptr; }
+}
+
 bool
 DMSFile::isCompatible(const std::filesystem::path &path)
 {
@@ -40,18 +65,155 @@ DMSFile::isCompatible(const Buffer<u8> &buf)
 void
 DMSFile::finalizeRead()
 {
-    u8* adfData = nullptr;
     size_t adfSize = 0;
-    
-    if (extractDMS(data.ptr, (size_t)data.size, &adfData, &adfSize, DMS_DEBUG) == 0) {
 
-        if (!FORCE_DMS_CANT_CREATE) {
-            adf.init(adfData, isize(adfSize));
+    // Determine the size of the unpacked disk without unpacking anything
+    if (scanDMS(data.ptr, (size_t)data.size, &adfSize) != 0 || adfSize == 0) {
+        throw Error(VAERROR_DMS_CANT_CREATE);
+    }
+    if (FORCE_DMS_CANT_CREATE) {
+        throw Error(VAERROR_DMS_CANT_CREATE);
+    }
+
+    // Create an empty disk of the proper size
+    adf.init(Buffer<u8>(isize(adfSize), 0));
+
+    // Unpack the first track to detect broken archives early
+    decode(1);
+
+    // Unpack the following tracks in the background
+    if (DMS_ASYNC_DECODE) {
+
+        target = std::min(lookahead * numSectors() * 512, adf.data.size);
+
+        worker = std::thread([this]() {
+
+            while (true) {
+
+                isize next;
+                {   std::unique_lock<std::mutex> lock(mutex);
+                    wakeup.wait(lock, [this]() { return cancel || finished || decoded < target; });
+                    if (cancel || finished) break;
+                    next = decoded + 1;
+                }
+                try { decode(next); } catch (...) { break; }
+            }
+        });
+    }
+}
+
+void
+DMSFile::fetch(isize count) const
+{
+    // Let the worker thread unpack a few tracks ahead
+    if (DMS_ASYNC_DECODE) {
+
+        {   std::lock_guard<std::mutex> guard(mutex);
+            auto ahead = std::min(count + lookahead * numSectors() * 512, adf.data.size);
+            target = std::max(target, ahead);
+        }
+        wakeup.notify_one();
+    }
+
+    decode(count);
+}
+
+void
+DMSFile::decode(isize count) const
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    if (failed) throw Error(VAERROR_DMS_CANT_CREATE);
+    if (decoded >= count || finished) return;
+
+    std::lock_guard<std::mutex> guard2(xdmsMutex);
+
+    const u8 *track;
+    size_t len;
+
+    // Take over the decoder if another archive is using it
+    if (xdmsOwner != this) {
+
+        debug(DMS_DEBUG, "Switching archives (%ld bytes unpacked so far)\n", decoded);
+
+        if (xdmsOwner) {
+
+            xdmsOwner->state.resize(sizeofDMSState());
+            saveDMS(xdmsOwner->state.data());
+        }
+
+        auto err = state.empty() ?
+        openDMS(data.ptr, (size_t)data.size) :
+        restoreDMS(data.ptr, (size_t)data.size, state.data());
+
+        if (err != 0) {
+
+            xdmsOwner = nullptr;
+            finished = failed = true;
+            throw Error(VAERROR_DMS_CANT_CREATE);
+        }
+        xdmsOwner = this;
+        state.clear();
+    }
+
+    // Unpack more tracks
+    while (!finished && decoded < count) {
+
+        switch (unpackNextDMSTrack(&track, &len)) {
+
+            case 0:
+            {
+                auto bytes = std::min(isize(len), adf.data.size - decoded);
+                std::memcpy(adf.data.ptr + decoded, track, bytes);
+                decoded += bytes;
+                break;
+            }
+            case 1:
+
+                finished = true;
+                break;
+
+            default:
+
+                warn("Failed to unpack the DMS archive\n");
+                finished = failed = true;
+                break;
         }
     }
-    
-    if (adfData) free(adfData);
-    if (!adf) throw Error(VAERROR_DMS_CANT_CREATE);
+
+    // Release the decoder when we are done
+    if (finished) { closeDMS(); xdmsOwner = nullptr; }
+    lock.unlock();
+    wakeup.notify_all();
+
+    if (failed) throw Error(VAERROR_DMS_CANT_CREATE);
+}
+
+u8
+DMSFile::readByte(isize b, isize offset) const
+{
+    fetch((b + 1) * 512);
+    return adf.readByte(b, offset);
+}
+
+void
+DMSFile::readSector(u8 *target, isize s) const
+{
+    fetch((s + 1) * 512);
+    adf.readSector(target, s);
+}
+
+void
+DMSFile::readSector(u8 *target, isize t, isize s) const
+{
+    fetch((t * numSectors() + s + 1) * 512);
+    adf.readSector(target, t, s);
+}
+
+void
+DMSFile::encodeDisk(class FloppyDisk &disk) const
+{
+    fetchAll();
+    adf.encodeDisk(disk);
 }
 
 }
@@ -10,13 +10,52 @@
 #pragma once
 
 #include "ADFFile.h"
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 namespace vamiga {
 
+/* DMS archives are unpacked lazily. When a file is read, the track headers
+ * are scanned to determine the disk size, and only the first track is
+ * unpacked. All other tracks are unpacked on demand when sectors are read or
+ * the disk is encoded. If DMS_ASYNC_DECODE is set, a worker thread unpacks a
+ * few tracks ahead of the latest request in the background. Once a track
+ * fails to unpack, all accessors that depend on the unpacked data throw an
+ * exception.
+ */
 class DMSFile : public FloppyFile {
 
+    // Number of tracks the worker thread unpacks ahead of a request
+    static constexpr isize lookahead = 4;
+
+    // The unpacked disk (filled on demand)
     ADFFile adf;
 
+    // Number of unpacked bytes in the ADF
+    mutable isize decoded = 0;
+
+    // Number of bytes the worker thread unpacks up to
+    mutable isize target = 0;
+
+    // Indicates that all tracks have been processed
+    mutable bool finished = false;
+
+    // Indicates that an error occurred while unpacking
+    mutable bool failed = false;
+
+    // Protects the variables from above
+    mutable std::mutex mutex;
+
+    // Saved xDMS state if another archive took over the decoder
+    mutable std::vector<u8> state;
+
+    // Background decoder
+    std::thread worker;
+    mutable std::condition_variable wakeup;
+    bool cancel = false;
+
 public:
     
     static bool isCompatible(const std::filesystem::path &path);
@@ -35,16 +74,28 @@ public:
     DMSFile(const std::filesystem::path &path) throws { init(path); }
     // DMSFile(const std::filesystem::path &path, std::istream &stream) throws { init(path, stream); }
     DMSFile(const u8 *buf, isize len) throws { init(buf, len); }
+    ~DMSFile();
     
     const char *objectName() const override { return "DMS"; }
 
+private:
+
+    // Makes the first 'count' bytes of the ADF available
+    void fetch(isize count) const throws;
+    void fetchAll() const { fetch(adf.data.size); }
+
+    // Unpacks tracks until the first 'count' bytes of the ADF are available
+    void decode(isize count) const throws;
+
+public:
+
     
     //
     // Methods from AmigaFile
     //
     
     FileType type() const override { return FILETYPE_DMS; }
-    u64 fnv64() const override { return adf.fnv64(); }
+    u64 fnv64() const override { fetchAll(); return adf.fnv64(); }
     bool isCompatiblePath(const std::filesystem::path &path) const override { return isCompatible(path); }
     bool isCompatibleBuffer(const u8 *buf, isize len) override { return isCompatible(buf, len); }
     void finalizeRead() throws override;
@@ -63,15 +114,16 @@ public:
     // Methods from FloppyFile
     //
     
-    FSVolumeType getDos() const override { return adf.getDos(); }
-    void setDos(FSVolumeType dos) override { adf.setDos(dos); }
+    FSVolumeType getDos() const override { fetch(4); return adf.getDos(); }
+    void setDos(FSVolumeType dos) override { fetch(4); adf.setDos(dos); modified = true; }
     Diameter getDiameter() const override { return adf.getDiameter(); }
     Density getDensity() const override { return adf.getDensity(); }
-    BootBlockType bootBlockType() const override { return adf.bootBlockType(); }
-    const char *bootBlockName() const override { return adf.bootBlockName(); }
-    void readSector(u8 *target, isize s) const override { return adf.readSector(target, s); }
-    void readSector(u8 *target, isize t, isize s) const override { return adf.readSector(target, t, s); }
-    void encodeDisk(class FloppyDisk &disk) const throws override { return adf.encodeDisk(disk); }
+    BootBlockType bootBlockType() const override { fetch(1024); return adf.bootBlockType(); }
+    const char *bootBlockName() const override { fetch(1024); return adf.bootBlockName(); }
+    u8 readByte(isize b, isize offset) const override;
+    void readSector(u8 *target, isize s) const override;
+    void readSector(u8 *target, isize t, isize s) const override;
+    void encodeDisk(class FloppyDisk &disk) const throws override;
 };
 
 }
@@ -19,6 +19,11 @@ class FloppyDisk;
 
 class FloppyFile : public DiskFile {
 
+protected:
+
+    // Indicates that the disk has been altered without changing the raw data
+    bool modified = false;
+
     //
     // Creating
     //
@@ -65,6 +70,9 @@ public:
 
     virtual void killVirus() { };
 
+    // Checks if the disk differs from what the raw data describes
+    bool isModified() const { return modified; }
+
 
     //
     // Encoding
@@ -71,12 +71,12 @@ public:
 public:
     
     FSVolumeType getDos() const override { return adf->getDos(); }
-    void setDos(FSVolumeType dos) override { adf->setDos(dos); }
+    void setDos(FSVolumeType dos) override { adf->setDos(dos); modified = true; }
     Diameter getDiameter() const override { return adf->getDiameter(); }
     Density getDensity() const override { return adf->getDensity(); }
     BootBlockType bootBlockType() const override { return adf->bootBlockType(); }
     const char *bootBlockName() const override { return adf->bootBlockName(); }
-    void killVirus() override { adf->killVirus(); }
+    void killVirus() override { adf->killVirus(); modified = true; }
     void readSector(u8 *target, isize s) const override { return adf->readSector(target, s); }
     void readSector(u8 *target, isize t, isize s) const override { return adf->readSector(target, t, s); }
     void encodeDisk(class FloppyDisk &disk) const throws override { adf->encodeDisk(disk); }
@@ -0,0 +1,252 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the Mozilla Public License v2
+//
+// See https://mozilla.org/MPL/2.0 for license information
+// -----------------------------------------------------------------------------
+
+#include "config.h"
+#include "MediaCache.h"
+#include "FloppyDisk.h"
+#include "FloppyFile.h"
+#include "Buffer.h"
+#include "Checksum.h"
+#include "IOUtils.h"
+#include "Error.h"
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+
+namespace vamiga {
+
+namespace fs = std::filesystem;
+
+// Bump this number whenever the MFM encoder or the entry layout changes
+static constexpr u32 cacheVersion = 2;
+
+// Magic bytes at the beginning of each cache entry
+static constexpr u8 cacheMagic[4] = { 'V', 'A', 'M', 'C' };
+
+fs::path MediaCache::directory;
+util::ReentrantMutex MediaCache::mutex;
+std::atomic<isize> MediaCache::hits = 0;
+std::atomic<isize> MediaCache::misses = 0;
+
+void
+MediaCache::setDirectory(const fs::path &path)
+{
+    SYNCHRONIZED
+
+    if (!path.empty() && !util::isDirectory(path) && !util::createDirectory(path)) {
+        throw Error(VAERROR_DIR_CANT_CREATE, path);
+    }
+    directory = path;
+}
+
+fs::path
+MediaCache::getDirectory()
+{
+    SYNCHRONIZED
+
+    return directory;
+}
+
+void
+MediaCache::clear()
+{
+    SYNCHRONIZED
+
+    if (directory.empty()) return;
+
+    for (auto &file : util::files(directory, ".mfm")) {
+
+        std::error_code ec;
+        fs::remove(directory / file, ec);
+    }
+}
+
+u64
+MediaCache::key(const FloppyFile &file)
+{
+    // Files without raw data (e.g., folders) are not cached
+    if (file.data.empty()) return 0;
+
+    // Nor are disks that have been altered via setDos() or killVirus()
+    if (file.isModified()) return 0;
+
+    auto result = util::fnvIt64(file.data.fnv64(), u64(file.type()));
+    return util::fnvIt64(result, cacheVersion);
+}
+
+fs::path
+MediaCache::entry(const fs::path &dir, u64 key)
+{
+    std::stringstream ss;
+    ss << std::hex << std::setw(16) << std::setfill('0') << key << ".mfm";
+
+    return dir / ss.str();
+}
+
+bool
+MediaCache::expand(const Buffer<u8> &src, Buffer<u8> &dst)
+{
+    /* Reverts Buffer::compress(2). Other than Buffer::uncompress(), this
+     * function writes into a preallocated buffer, which makes it a lot faster
+     * for the multi-megabyte images stored in the cache.
+     */
+    u8 prev = 0;
+    isize repetitions = 0, j = 0;
+
+    for (isize i = 0; i < src.size; i++) {
+
+        if (j == dst.size) return false;
+
+        dst[j++] = src[i];
+        repetitions = prev != src[i] ? 1 : repetitions + 1;
+        prev = src[i];
+
+        // Two equal bytes are followed by the number of additional copies
+        if (repetitions == 2 && i < src.size - 1) {
+
+            isize count = src[++i];
+            if (j + count > dst.size) return false;
+
+            memset(dst.ptr + j, prev, count);
+            j += count;
+            repetitions = 0;
+        }
+    }
+    return j == dst.size;
+}
+
+bool
+MediaCache::load(FloppyDisk &disk, const FloppyFile &file)
+{
+    auto dir = getDirectory();
+    if (dir.empty()) return false;
+
+    auto k = key(file);
+    if (k == 0) return false;
+
+    auto path = entry(dir, k);
+
+    auto miss = [&]() { misses++; return false; };
+
+    std::ifstream stream(path, std::ios::binary);
+    if (!stream.is_open()) return miss();
+
+    // Read the header
+    u8 magic[4];
+    u32 version = 0;
+    u8 diameter = 0, density = 0;
+    u16 numTracks = 0;
+    stream.read((char *)magic, sizeof(magic));
+    stream.read((char *)&version, sizeof(version));
+    stream.read((char *)&diameter, sizeof(diameter));
+    stream.read((char *)&density, sizeof(density));
+    stream.read((char *)&numTracks, sizeof(numTracks));
+
+    if (!stream ||
+        memcmp(magic, cacheMagic, sizeof(magic)) != 0 ||
+        version != cacheVersion ||
+        Diameter(diameter) != disk.diameter ||
+        Density(density) != disk.density ||
+        numTracks != disk.numTracks()) return miss();
+
+    // Read the track lengths
+    i32 length[168];
+    isize total = 0;
+    stream.read((char *)length, numTracks * sizeof(i32));
+    if (!stream) return miss();
+
+    for (isize t = 0; t < numTracks; t++) {
+
+        if (length[t] <= 0 || length[t] > 32768) return miss();
+        total += length[t];
+    }
+
+    // Read the run-length encoded track data
+    u64 size = 0;
+    stream.read((char *)&size, sizeof(size));
+    if (!stream || size == 0 || size > u64(sizeof(disk.data.raw))) return miss();
+
+    Buffer<u8> packed{isize(size)};
+    stream.read((char *)packed.ptr, size);
+    if (!stream) return miss();
+
+    Buffer<u8> buffer{total};
+    if (!expand(packed, buffer)) return miss();
+
+    // Restore the disk (gap bytes are filled the same way as by the encoder)
+    disk.clearDisk();
+    for (isize t = 0, offset = 0; t < numTracks; offset += length[t++]) {
+
+        disk.length.track[t] = length[t];
+        memcpy(disk.data.track[t], buffer.ptr + offset, length[t]);
+    }
+
+    hits++;
+    return true;
+}
+
+void
+MediaCache::save(const FloppyDisk &disk, const FloppyFile &file)
+{
+    auto dir = getDirectory();
+    if (dir.empty()) return;
+
+    auto k = key(file);
+    if (k == 0) return;
+
+    auto path = entry(dir, k);
+
+    // Collect the track data
+    auto numTracks = u16(disk.numTracks());
+    isize total = 0;
+    for (isize t = 0; t < numTracks; t++) total += disk.length.track[t];
+
+    Buffer<u8> buffer(total);
+    for (isize t = 0, offset = 0; t < numTracks; offset += disk.length.track[t++]) {
+        memcpy(buffer.ptr + offset, disk.data.track[t], disk.length.track[t]);
+    }
+    buffer.compress(2);
+
+    // Write to a temporary file first to never expose a partial entry
+    std::stringstream ss;
+    ss << path.string() << "." << std::this_thread::get_id() << ".tmp";
+    auto tmp = fs::path(ss.str());
+
+    {   std::ofstream stream(tmp, std::ios::binary);
+        if (!stream.is_open()) return;
+
+        auto diameter = u8(disk.diameter);
+        auto density = u8(disk.density);
+        auto size = u64(buffer.size);
+
+        stream.write((const char *)cacheMagic, sizeof(cacheMagic));
+        stream.write((const char *)&cacheVersion, sizeof(cacheVersion));
+        stream.write((const char *)&diameter, sizeof(diameter));
+        stream.write((const char *)&density, sizeof(density));
+        stream.write((const char *)&numTracks, sizeof(numTracks));
+        stream.write((const char *)disk.length.track, numTracks * sizeof(i32));
+        stream.write((const char *)&size, sizeof(size));
+        stream.write((const char *)buffer.ptr, buffer.size);
+
+        if (!stream) {
+
+            std::error_code ec;
+            stream.close();
+            fs::remove(tmp, ec);
+            return;
+        }
+    }
+
+    std::error_code ec;
+    fs::rename(tmp, path, ec);
+    if (ec) fs::remove(tmp, ec);
+}
+
+}
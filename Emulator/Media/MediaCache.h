@@ -0,0 +1,89 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the Mozilla Public License v2
+//
+// See https://mozilla.org/MPL/2.0 for license information
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "BasicTypes.h"
+#include "Exception.h"
+#include "Buffer.h"
+#include "Synchronizable.h"
+#include <atomic>
+#include <filesystem>
+
+namespace vamiga {
+
+using util::Buffer;
+
+class FloppyDisk;
+class FloppyFile;
+
+/* The media cache keeps the MFM encoded images of floppy disks on the host
+ * file system. Entries are addressed by a hash over the raw file contents and
+ * the file type. When the same disk is inserted again, the tracks are read
+ * from the cache instead of unpacking and encoding the file another time.
+ * Disks that have been altered via setDos() or killVirus() without touching
+ * the raw data are never cached. The cache is disabled unless a directory has
+ * been assigned.
+ */
+class MediaCache {
+
+    // Cache location (empty if the cache is disabled)
+    static std::filesystem::path directory;
+
+    // Protects the cache directory
+    static util::ReentrantMutex mutex;
+
+    // Statistics
+    static std::atomic<isize> hits;
+    static std::atomic<isize> misses;
+
+
+    //
+    // Configuring
+    //
+
+public:
+
+    // Enables the cache by assigning a directory (an empty path disables it)
+    static void setDirectory(const std::filesystem::path &path) throws;
+    static std::filesystem::path getDirectory();
+
+    // Deletes all cache entries
+    static void clear();
+
+    // Returns cache statistics
+    static isize numHits() { return hits; }
+    static isize numMisses() { return misses; }
+
+
+    //
+    // Accessing the cache
+    //
+
+public:
+
+    // Computes the cache key for a file (0 = file can't be cached)
+    static u64 key(const FloppyFile &file);
+
+    // Restores the MFM encoded tracks of a file (returns false on a miss)
+    static bool load(FloppyDisk &disk, const FloppyFile &file);
+
+    // Stores the MFM encoded tracks of a file
+    static void save(const FloppyDisk &disk, const FloppyFile &file);
+
+private:
+
+    // Expands a run-length encoded buffer into a buffer of known size
+    static bool expand(const Buffer<u8> &src, Buffer<u8> &dst);
+
+    // Returns the path of the cache entry with the given key
+    static std::filesystem::path entry(const std::filesystem::path &dir, u64 key);
+};
+
+}
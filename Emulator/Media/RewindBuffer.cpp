@@ -0,0 +1,253 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the Mozilla Public License v2
+//
+// See https://mozilla.org/MPL/2.0 for license information
+// -----------------------------------------------------------------------------
+
+#include "config.h"
+#include "RewindBuffer.h"
+#include "Amiga.h"
+#include "Error.h"
+#include <cstring>
+
+namespace vamiga {
+
+void
+RewindBuffer::clear()
+{
+    SYNCHRONIZED
+
+    entries.clear();
+    latest.clear();
+    latest.shrink_to_fit();
+    current.clear();
+    current.shrink_to_fit();
+    used = 0;
+    deltas = 0;
+}
+
+void
+RewindBuffer::setKeyInterval(isize frames)
+{
+    SYNCHRONIZED
+
+    keyInterval = std::max(isize(1), frames);
+}
+
+void
+RewindBuffer::setBudget(isize bytes)
+{
+    SYNCHRONIZED
+
+    budget = bytes;
+    while (used > budget && !entries.empty()) dropOldest();
+}
+
+isize
+RewindBuffer::count() const
+{
+    SYNCHRONIZED
+
+    return isize(entries.size());
+}
+
+i64
+RewindBuffer::firstFrame() const
+{
+    SYNCHRONIZED
+
+    return entries.empty() ? -1 : entries.front().frame;
+}
+
+i64
+RewindBuffer::lastFrame() const
+{
+    SYNCHRONIZED
+
+    return entries.empty() ? -1 : entries.back().frame;
+}
+
+isize
+RewindBuffer::memoryUsage() const
+{
+    SYNCHRONIZED
+
+    return used;
+}
+
+void
+RewindBuffer::record()
+{
+    SYNCHRONIZED
+
+    auto frame = amiga.agnus.pos.frame;
+
+    // Serialize the current state (checksums are not needed in memory)
+    current.resize(amiga.size());
+    amiga.save(current.data(), false);
+
+    // Discard all frames that lie in the future (e.g., after a reset)
+    if (!entries.empty() && entries.back().frame >= frame) {
+
+        while (!entries.empty() && entries.back().frame >= frame) {
+
+            used -= isize(entries.back().data.size());
+            entries.pop_back();
+        }
+        latest.clear();
+    }
+
+    // Decide whether to record a keyframe or a delta
+    bool keyframe =
+    latest.size() != current.size() || deltas + 1 >= keyInterval;
+
+    Entry entry = { .frame = frame, .keyframe = keyframe, .data = { } };
+    encode(current, keyframe ? std::vector<u8>() : latest, entry.data);
+
+    used += isize(entry.data.size());
+    entries.push_back(std::move(entry));
+    deltas = keyframe ? 0 : deltas + 1;
+    std::swap(latest, current);
+
+    // Stay within the memory budget
+    while (used > budget && !entries.empty()) dropOldest();
+}
+
+void
+RewindBuffer::seek(i64 frame)
+{
+    SYNCHRONIZED
+
+    // Find the requested frame
+    isize nr = isize(entries.size()) - 1;
+    while (nr >= 0 && entries[nr].frame != frame) nr--;
+    if (nr < 0) throw Error(VAERROR_SNAP_UNAVAILABLE, std::to_string(frame));
+
+    // Find the keyframe in front of it
+    isize key = nr;
+    while (!entries[key].keyframe) key--;
+
+    // Reconstruct the state
+    current.clear();
+    for (isize i = key; i <= nr; i++) decode(entries[i].data, current);
+
+    try {
+
+        // Restore the state
+        amiga.load(current.data(), false);
+
+    } catch (Error &error) {
+
+        // Don't leave the emulator in an inconsistent state (see loadSnapshot)
+        amiga.hardReset();
+        throw error;
+    }
+
+    // Continue recording from here
+    while (isize(entries.size()) > nr + 1) {
+
+        used -= isize(entries.back().data.size());
+        entries.pop_back();
+    }
+    deltas = nr - key;
+    std::swap(latest, current);
+}
+
+void
+RewindBuffer::dropOldest()
+{
+    assert(!entries.empty() && entries.front().keyframe);
+
+    do {
+
+        used -= isize(entries.front().data.size());
+        entries.pop_front();
+
+    } while (!entries.empty() && !entries.front().keyframe);
+
+    // Start over with a keyframe if nothing is left
+    if (entries.empty()) latest.clear();
+}
+
+void
+RewindBuffer::encode(const std::vector<u8> &src, const std::vector<u8> &ref, std::vector<u8> &dst)
+{
+    /* The encoded data starts with the size of the decoded buffer, followed
+     * by a sequence of chunks. Each chunk consists of the number of bytes to
+     * skip (XOR value 0), the number of literal bytes, and the literal bytes
+     * (XOR values).
+     */
+    static constexpr isize minRun = 16;
+
+    auto n = isize(src.size());
+    auto s = src.data();
+    auto r = ref.empty() ? nullptr : ref.data();
+
+    assert(!r || isize(ref.size()) == n);
+
+    auto equal = [&](isize i) { return r ? s[i] == r[i] : s[i] == 0; };
+    auto put = [&](u32 value) {
+        auto p = (const u8 *)&value; dst.insert(dst.end(), p, p + sizeof(value));
+    };
+
+    dst.clear();
+    dst.reserve(r ? 4096 : n / 2);
+    put(u32(n));
+
+    for (isize i = 0; i < n;) {
+
+        // Skip all bytes that haven't changed (eight at a time if possible)
+        isize skip = i;
+        if (r) {
+            while (i + 8 <= n && std::memcmp(s + i, r + i, 8) == 0) i += 8;
+        } else {
+            u64 word;
+            while (i + 8 <= n && (std::memcpy(&word, s + i, 8), word == 0)) i += 8;
+        }
+        while (i < n && equal(i)) i++;
+        skip = i - skip;
+
+        // Collect all changed bytes up to the next long run of unchanged ones
+        isize literal = i;
+        while (i < n) {
+
+            if (!equal(i)) { i++; continue; }
+
+            isize j = i;
+            while (j < n && j - i < minRun && equal(j)) j++;
+            if (j == n || j - i == minRun) break;
+            i = j;
+        }
+        literal = i - literal;
+
+        // Write the chunk
+        put(u32(skip));
+        put(u32(literal));
+        for (isize k = i - literal; k < i; k++) dst.push_back(r ? s[k] ^ r[k] : s[k]);
+    }
+}
+
+void
+RewindBuffer::decode(const std::vector<u8> &src, std::vector<u8> &dst)
+{
+    auto p = src.data();
+    auto end = p + src.size();
+    auto get = [&]() { u32 value; std::memcpy(&value, p, sizeof(value)); p += sizeof(value); return value; };
+
+    // Keyframes are decoded into an empty buffer
+    auto n = isize(get());
+    if (dst.empty()) dst.assign(n, 0);
+    assert(isize(dst.size()) == n);
+
+    for (isize i = 0; p < end;) {
+
+        i += get();
+        auto literal = isize(get());
+        for (isize k = 0; k < literal; k++) dst[i++] ^= *p++;
+    }
+}
+
+}
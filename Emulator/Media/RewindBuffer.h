@@ -0,0 +1,132 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the Mozilla Public License v2
+//
+// See https://mozilla.org/MPL/2.0 for license information
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "BasicTypes.h"
+#include "Exception.h"
+#include "Synchronizable.h"
+#include <deque>
+#include <vector>
+
+namespace vamiga {
+
+class Amiga;
+
+/* The rewind buffer records the emulator state at the end of each frame. To
+ * keep the memory footprint small, only every n-th frame is stored as a full
+ * keyframe. All other frames are stored as the difference to the previous
+ * frame. Differences are computed by XORing the serialized states, which
+ * results in long runs of zeroes that compress well with a simple run-length
+ * encoding. Keyframes use the same encoding.
+ *
+ * To restore a frame, the buffer decodes the closest keyframe in front of it
+ * and applies all deltas up to the requested frame. If the memory budget is
+ * exceeded, the oldest keyframe is dropped together with its deltas.
+ */
+class RewindBuffer {
+
+    struct Entry {
+
+        // Frame number
+        i64 frame;
+
+        // Indicates if this entry is a keyframe or a delta
+        bool keyframe;
+
+        // Run-length encoded state (keyframe) or state difference (delta)
+        std::vector<u8> data;
+    };
+
+    // Reference to the recorded Amiga
+    Amiga &amiga;
+
+    // Recorded frames (in ascending order)
+    std::deque<Entry> entries;
+
+    // Serialized state of the most recently recorded frame
+    std::vector<u8> latest;
+
+    // Serialized state of the current frame
+    std::vector<u8> current;
+
+    // Number of frames between two keyframes
+    isize keyInterval = 50;
+
+    // Number of deltas recorded since the last keyframe
+    isize deltas = 0;
+
+    // Memory budget in bytes
+    isize budget = 64 * 1024 * 1024;
+
+    // Number of bytes occupied by all entries
+    isize used = 0;
+
+    // Protects all members from concurrent access
+    mutable util::ReentrantMutex mutex;
+
+
+    //
+    // Initializing
+    //
+
+public:
+
+    RewindBuffer(Amiga& ref) : amiga(ref) { }
+
+    // Deletes all recorded frames
+    void clear();
+
+    // Sets the keyframe interval and the memory budget
+    void setKeyInterval(isize frames);
+    void setBudget(isize bytes);
+
+
+    //
+    // Querying
+    //
+
+public:
+
+    // Returns the number of recorded frames
+    isize count() const;
+
+    // Returns the first and the last recorded frame (-1 if the buffer is empty)
+    i64 firstFrame() const;
+    i64 lastFrame() const;
+
+    // Returns the number of bytes occupied by all recorded frames
+    isize memoryUsage() const;
+
+
+    //
+    // Recording and restoring
+    //
+
+public:
+
+    // Records the current emulator state
+    void record();
+
+    // Restores the emulator state of a recorded frame
+    void seek(i64 frame) throws;
+
+private:
+
+    // Removes the oldest keyframe together with all of its deltas
+    void dropOldest();
+
+    // Run-length encodes the XOR of two buffers (ref may be empty)
+    static void encode(const std::vector<u8> &src, const std::vector<u8> &ref, std::vector<u8> &dst);
+
+    // Reverts encode() by XORing the decoded data into a buffer
+    static void decode(const std::vector<u8> &src, std::vector<u8> &dst);
+};
+
+}
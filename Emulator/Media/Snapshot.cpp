@@ -118,6 +118,9 @@ Snapshot::timestamp() const
     return getThumbnail().timestamp;
 }
 
+// Orders beta numbers such that the release version comes last
+static isize betaRank(isize beta) { return beta ? beta : 256; }
+
 bool
 Snapshot::isTooOld() const
 {
@@ -127,8 +130,11 @@ Snapshot::isTooOld() const
     if (header->major > SNP_MAJOR) return false;
     if (header->minor < SNP_MINOR) return true;
     if (header->minor > SNP_MINOR) return false;
-    
-    return header->subminor < SNP_SUBMINOR;
+    if (header->subminor < SNP_SUBMINOR) return true;
+    if (header->subminor > SNP_SUBMINOR) return false;
+
+    // Release versions (beta 0) supersede all beta versions
+    return betaRank(header->beta) < betaRank(SNP_BETA);
 }
 
 bool
@@ -140,8 +146,11 @@ Snapshot::isTooNew() const
     if (header->major < SNP_MAJOR) return false;
     if (header->minor > SNP_MINOR) return true;
     if (header->minor < SNP_MINOR) return false;
+    if (header->subminor > SNP_SUBMINOR) return true;
+    if (header->subminor < SNP_SUBMINOR) return false;
 
-    return header->subminor > SNP_SUBMINOR;
+    // Release versions (beta 0) supersede all beta versions
+    return betaRank(header->beta) > betaRank(SNP_BETA);
 }
 
 bool
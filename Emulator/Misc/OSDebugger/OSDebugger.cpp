@@ -212,8 +212,9 @@ OSDebugger::isValidPtr(u32 addr) const
 bool
 OSDebugger::searchLibrary(u32 addr, os::Library &result) const
 {
-    std::vector <os::Library> libraries;
-    read(getExecBase().LibList.lh_Head, libraries);
+    SYNCHRONIZED
+
+    auto &libraries = getExecLists().libraries;
     
     for (usize i = 0; i < libraries.size(); i++) {
         
@@ -230,8 +231,9 @@ OSDebugger::searchLibrary(u32 addr, os::Library &result) const
 bool
 OSDebugger::searchLibrary(const string &name, os::Library &result) const
 {
-    std::vector <os::Library> libraries;
-    read(getExecBase().LibList.lh_Head, libraries);
+    SYNCHRONIZED
+
+    auto &libraries = getExecLists().libraries;
 
     for (usize i = 0; i < libraries.size(); i++) {
         
@@ -251,8 +253,9 @@ OSDebugger::searchLibrary(const string &name, os::Library &result) const
 bool
 OSDebugger::searchDevice(u32 addr, os::Library &result) const
 {
-    std::vector <os::Library> devices;
-    read(getExecBase().DeviceList.lh_Head, devices);
+    SYNCHRONIZED
+
+    auto &devices = getExecLists().devices;
     
     for (usize i = 0; i < devices.size(); i++) {
         
@@ -269,8 +272,9 @@ OSDebugger::searchDevice(u32 addr, os::Library &result) const
 bool
 OSDebugger::searchDevice(const string &name, os::Library &result) const
 {
-    std::vector <os::Library> devices;
-    read(getExecBase().DeviceList.lh_Head, devices);
+    SYNCHRONIZED
+
+    auto &devices = getExecLists().devices;
     
     for (usize i = 0; i < devices.size(); i++) {
         
@@ -290,8 +294,9 @@ OSDebugger::searchDevice(const string &name, os::Library &result) const
 bool
 OSDebugger::searchResource(u32 addr, os::Library &result) const
 {
-    std::vector <os::Library> resources;
-    read(getExecBase().ResourceList.lh_Head, resources);
+    SYNCHRONIZED
+
+    auto &resources = getExecLists().resources;
     
     for (usize i = 0; i < resources.size(); i++) {
         
@@ -308,8 +313,9 @@ OSDebugger::searchResource(u32 addr, os::Library &result) const
 bool
 OSDebugger::searchResource(const string &name, os::Library &result) const
 {
-    std::vector <os::Library> resources;
-    read(getExecBase().ResourceList.lh_Head, resources);
+    SYNCHRONIZED
+
+    auto &resources = getExecLists().resources;
     
     for (usize i = 0; i < resources.size(); i++) {
         
@@ -12,6 +12,7 @@
 #include "OSDebuggerTypes.h"
 #include "SubComponent.h"
 #include "Constants.h"
+#include <unordered_map>
 
 namespace vamiga {
 
@@ -29,6 +30,33 @@ class OSDebugger final : public SubComponent {
 
     };
 
+    // Number of bytes occupied by a node in Amiga memory
+    static constexpr isize librarySize = 34;
+    static constexpr isize taskSize = 92;
+    static constexpr isize processSize = 228;
+
+    /* Cached nodes. Each entry stores a copy of the memory area a node has
+     * been decoded from. As long as the memory contents match the copy, the
+     * decoded node is reused. Entries not visited during a refresh are
+     * discarded.
+     */
+    template <class T, isize N> struct NodeCache {
+
+        struct Entry { u8 raw[N]; T node; };
+
+        std::unordered_map<u32, Entry> prev;
+        std::unordered_map<u32, Entry> curr;
+
+        void begin() { std::swap(prev, curr); curr.clear(); }
+    };
+
+    mutable NodeCache<os::Library, librarySize> libraryCache;
+    mutable NodeCache<os::Task, taskSize> taskCache;
+    mutable NodeCache<os::Process, processSize> processCache;
+
+    // Most recent view of all ExecBase lists
+    mutable os::ExecLists execLists = { };
+
 private:
     
     //
@@ -169,6 +197,34 @@ public:
     void read(const os::Process &pr, os::SegList &result) const;
     void read(u32 addr, os::SegList &result) const;
 
+
+    //
+    // Caching structures
+    //
+
+public:
+
+    // Returns all ExecBase lists (valid until the next call)
+    const os::ExecLists &getExecLists() const throws;
+
+    // Returns a copy of all ExecBase lists (taken while holding the lock)
+    os::ExecLists copyExecLists() const throws;
+
+private:
+
+    // Refreshes the cached view of all ExecBase lists
+    void refreshExecLists() const throws;
+
+    // Reads a node or takes it from the cache (returns true if it has changed)
+    template <class T, isize N>
+    bool readCached(u32 addr, T *result, NodeCache<T, N> &cache) const;
+
+    // Reads a list of nodes using the cache (returns true if a node has changed)
+    template <class T, isize N>
+    bool readCached(u32 addr, std::vector <T> &result, NodeCache<T, N> &cache) const;
+
+public:
+
     
     //
     // Searches a structure by value (address or index), or name
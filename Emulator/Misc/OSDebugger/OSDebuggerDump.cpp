@@ -190,8 +190,7 @@ OSDebugger::dumpLibraries(std::ostream& s)
 {
     {   SUSPENDED
         
-        std::vector <os::Library> libraries;
-        read(getExecBase().LibList.lh_Head, libraries);
+        auto &libraries = getExecLists().libraries;
         
         for (auto &library : libraries) {
             
@@ -278,8 +277,7 @@ OSDebugger::dumpDevices(std::ostream& s)
 {
     {   SUSPENDED
         
-        std::vector <os::Library> devices;
-        read(getExecBase().DeviceList.lh_Head, devices);
+        auto &devices = getExecLists().devices;
         
         for (auto &device : devices) {
             dumpLibrary(s, device, false);
@@ -327,8 +325,7 @@ OSDebugger::dumpResources(std::ostream& s)
 {
     {   SUSPENDED
         
-        std::vector <os::Library> resources;
-        read(getExecBase().DeviceList.lh_Head, resources);
+        auto &resources = getExecLists().resources;
         
         for (auto &resource : resources) {
             dumpLibrary(s, resource, false);
@@ -11,6 +11,8 @@
 #include "OSDebugger.h"
 #include "IOUtils.h"
 #include "Memory.h"
+#include <algorithm>
+#include <cstring>
 
 namespace vamiga {
 
@@ -450,31 +452,19 @@ OSDebugger::read(u32 addr, std::vector <os::FileSysEntry> &result) const
 void
 OSDebugger::read(std::vector <os::Task> &result) const
 {
-    auto execBase = getExecBase();
+    SYNCHRONIZED
 
-    os::Task current;
-    read(execBase.ThisTask, &current);
-    
-    result.push_back(current);
-    read(execBase.TaskReady.lh_Head, result);
-    read(execBase.TaskWait.lh_Head, result);
+    auto &tasks = getExecLists().tasks;
+    result.insert(result.end(), tasks.begin(), tasks.end());
 }
 
 void
 OSDebugger::read(std::vector <os::Process> &result) const
 {
-    std::vector <os::Task> tasks;
-    read(tasks);
-    
-    for (auto &t : tasks) {
-        
-        if (t.tc_Node.ln_Type == os::NT_PROCESS) {
-            
-            os::Process process;
-            read(t.addr, &process);
-            result.push_back(process);
-        }
-    }
+    SYNCHRONIZED
+
+    auto &processes = getExecLists().processes;
+    result.insert(result.end(), processes.begin(), processes.end());
 }
 
 void
@@ -558,4 +548,126 @@ OSDebugger::read(u32 addr, os::SegList &result) const
     }
 }
 
+
+
+//
+// Caching structures
+//
+
+static u32 successor(const os::Library &node) { return node.lib_Node.ln_Succ; }
+static u32 successor(const os::Task &node) { return node.tc_Node.ln_Succ; }
+
+template <class T, isize N> bool
+OSDebugger::readCached(u32 addr, T *result, NodeCache<T, N> &cache) const
+{
+    auto raw = mem.spyPtr(addr, N);
+
+    // Nodes outside Ram and Rom are always decoded
+    if (!raw) { read(addr, result); return true; }
+
+    // Reuse the cached node if the memory contents haven't changed
+    if (auto it = cache.prev.find(addr); it != cache.prev.end()) {
+
+        if (std::memcmp(it->second.raw, raw, N) == 0) {
+
+            *result = it->second.node;
+            cache.curr.insert(cache.prev.extract(it));
+            return false;
+        }
+    }
+
+    // Decode the node and cache it
+    read(addr, result);
+
+    auto &entry = cache.curr[addr];
+    std::memcpy(entry.raw, raw, N);
+    entry.node = *result;
+
+    return true;
+}
+
+template <class T, isize N> bool
+OSDebugger::readCached(u32 addr, std::vector <T> &result, NodeCache<T, N> &cache) const
+{
+    bool changed = false;
+
+    for (isize i = 0; isValidPtr(addr) && i < 128; i++) {
+
+        T node;
+        changed |= readCached(addr, &node, cache);
+
+        addr = successor(node);
+        if (addr) result.push_back(node);
+    }
+
+    return changed;
+}
+
+const os::ExecLists &
+OSDebugger::getExecLists() const
+{
+    SYNCHRONIZED
+
+    refreshExecLists();
+    return execLists;
+}
+
+os::ExecLists
+OSDebugger::copyExecLists() const
+{
+    SYNCHRONIZED
+
+    return getExecLists();
+}
+
+void
+OSDebugger::refreshExecLists() const
+{
+    os::ExecLists result = { };
+    bool changed = false;
+
+    result.execBase = getExecBase();
+    auto &exec = result.execBase;
+
+    libraryCache.begin();
+    taskCache.begin();
+    processCache.begin();
+
+    // Libraries, devices, and resources
+    changed |= readCached(exec.LibList.lh_Head, result.libraries, libraryCache);
+    changed |= readCached(exec.DeviceList.lh_Head, result.devices, libraryCache);
+    changed |= readCached(exec.ResourceList.lh_Head, result.resources, libraryCache);
+
+    // Tasks (the running task first, followed by all ready and waiting tasks)
+    os::Task current = { };
+    if (isValidPtr(exec.ThisTask)) changed |= readCached(exec.ThisTask, &current, taskCache);
+    result.tasks.push_back(current);
+    changed |= readCached(exec.TaskReady.lh_Head, result.tasks, taskCache);
+    changed |= readCached(exec.TaskWait.lh_Head, result.tasks, taskCache);
+
+    // Processes
+    for (auto &t : result.tasks) {
+
+        if (t.tc_Node.ln_Type == os::NT_PROCESS) {
+
+            os::Process process;
+            changed |= readCached(t.addr, &process, processCache);
+            result.processes.push_back(process);
+        }
+    }
+
+    // Check if nodes have been added or removed
+    auto same = [](auto &v1, auto &v2) {
+        return std::equal(v1.begin(), v1.end(), v2.begin(), v2.end(),
+                          [](auto &n1, auto &n2) { return n1.addr == n2.addr; });
+    };
+    changed |= !same(result.libraries, execLists.libraries);
+    changed |= !same(result.devices, execLists.devices);
+    changed |= !same(result.resources, execLists.resources);
+    changed |= !same(result.tasks, execLists.tasks);
+
+    result.version = execLists.version + (changed ? 1 : 0);
+    execLists = std::move(result);
+}
+
 }
@@ -434,4 +434,20 @@ typedef struct ExecBase
 }
 ExecBase;
 
+// All lists managed by ExecBase (see OSDebugger::getExecLists())
+typedef struct ExecLists
+{
+    ExecBase execBase;
+
+    std::vector<Library> libraries;
+    std::vector<Library> devices;
+    std::vector<Library> resources;
+    std::vector<Task> tasks;
+    std::vector<Process> processes;
+
+    // Incremented whenever one of the lists has changed
+    u64 version;
+}
+ExecLists;
+
 }
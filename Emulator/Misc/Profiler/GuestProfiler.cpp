@@ -0,0 +1,350 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the Mozilla Public License v2
+//
+// See https://mozilla.org/MPL/2.0 for license information
+// -----------------------------------------------------------------------------
+
+#include "config.h"
+#include "GuestProfiler.h"
+#include "Amiga.h"
+#include "IOUtils.h"
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+namespace vamiga {
+
+GuestProfiler::GuestProfiler(Amiga& ref) : amiga(ref) { }
+
+void
+GuestProfiler::clear()
+{
+    table.assign(4096, Entry { .key = empty, .cycles = 0 });
+    used = 0;
+    lastKey = empty;
+}
+
+void
+GuestProfiler::start(i64 interval)
+{
+    if (table.empty()) clear();
+
+    this->interval = std::max(i64(0), interval);
+    lastKey = empty;
+    lastClock = amiga.cpu.getClock();
+    running = true;
+}
+
+void
+GuestProfiler::stop()
+{
+    running = false;
+}
+
+void
+GuestProfiler::record()
+{
+    auto clock = amiga.cpu.getClock();
+
+    if (interval) {
+
+        // Sampling mode: Take a sample every 'interval' cycles
+        if (clock - lastClock >= interval) {
+
+            auto elapsed = interval * ((clock - lastClock) / interval);
+            add(currentKey(), elapsed);
+            lastClock += elapsed;
+        }
+
+    } else {
+
+        // Exact mode: Charge the elapsed cycles to the previous instruction
+        if (lastKey != empty) add(lastKey, clock - lastClock);
+
+        lastKey = currentKey();
+        lastClock = clock;
+    }
+}
+
+u64
+GuestProfiler::currentKey() const
+{
+    auto &cpu = amiga.cpu;
+    auto &mem = amiga.mem;
+
+    u32 task = 0;
+
+    // Code running in supervisor mode is not attributed to any task
+    if (!(cpu.getSR() & 0x2000)) {
+
+        auto execBase = mem.spypeek32 <ACCESSOR_CPU> (4);
+        if (IS_EVEN(execBase)) task = mem.spypeek32 <ACCESSOR_CPU> (execBase + 276);
+    }
+
+    return u64(cpu.getPC0()) << 32 | task;
+}
+
+void
+GuestProfiler::add(u64 key, i64 cycles)
+{
+    auto mask = table.size() - 1;
+    auto i = util::fnvIt64(util::fnvInit64(), key) & mask;
+
+    // Linear probing
+    while (table[i].key != key) {
+
+        if (table[i].key == empty) {
+
+            if (4 * (used + 1) > 3 * isize(table.size())) {
+
+                grow();
+                add(key, cycles);
+                return;
+            }
+            table[i].key = key;
+            used++;
+            break;
+        }
+        i = (i + 1) & mask;
+    }
+    table[i].cycles += cycles;
+}
+
+void
+GuestProfiler::grow()
+{
+    auto old = std::move(table);
+
+    table.assign(2 * old.size(), Entry { .key = empty, .cycles = 0 });
+    used = 0;
+
+    for (auto &entry : old) {
+        if (entry.key != empty) add(entry.key, entry.cycles);
+    }
+}
+
+i64
+GuestProfiler::total() const
+{
+    i64 result = 0;
+    for (auto &entry : table) if (entry.key != empty) result += entry.cycles;
+
+    return result;
+}
+
+std::vector<GuestProfiler::Entry>
+GuestProfiler::sorted() const
+{
+    std::vector<Entry> result;
+
+    for (auto &entry : table) if (entry.key != empty) result.push_back(entry);
+    std::sort(result.begin(), result.end(), [](const Entry &a, const Entry &b) {
+        return a.cycles != b.cycles ? a.cycles > b.cycles : a.key < b.key;
+    });
+
+    return result;
+}
+
+std::vector<GuestProfiler::Symbol>
+GuestProfiler::collectSymbols() const
+{
+    auto &mem = amiga.mem;
+    auto &osDebugger = amiga.osDebugger;
+
+    std::vector<Symbol> result;
+
+    auto valid = [&](u32 addr) {
+        return addr && IS_EVEN(addr) && (mem.inRam(addr) || mem.inRom(addr));
+    };
+    auto name = [&](u32 addr) {
+        string str; osDebugger.read(addr, str, 64);
+        std::replace(str.begin(), str.end(), ';', '_');
+        return str.empty() ? "???" : str;
+    };
+
+    // Read all lists in a single pass
+    os::ExecLists lists;
+    try { lists = osDebugger.copyExecLists(); } catch (...) { return result; }
+
+    // Collect the hunks of all processes
+    for (auto &process : lists.processes) {
+
+        os::SegList segList;
+        osDebugger.read(process, segList);
+
+        auto module = name(process.pr_Task.tc_Node.ln_Name);
+        for (usize i = 0; i < segList.size(); i++) {
+
+            result.push_back(Symbol {
+                .addr = segList[i].first,
+                .size = segList[i].second,
+                .module = module,
+                .name = "hunk" + std::to_string(i) });
+        }
+    }
+
+    // Collect the entry points of all library and device functions
+    auto libraries = lists.libraries;
+    libraries.insert(libraries.end(), lists.devices.begin(), lists.devices.end());
+
+    for (auto &library : libraries) {
+
+        auto module = name(library.lib_Node.ln_Name);
+        for (isize lvo = 6; lvo <= library.lib_NegSize; lvo += 6) {
+
+            // Each jump table entry is a JMP <abs>.L instruction
+            auto entry = library.addr - u32(lvo);
+            if (mem.spypeek16 <ACCESSOR_CPU> (entry) != 0x4EF9) continue;
+
+            auto target = mem.spypeek32 <ACCESSOR_CPU> (entry + 2);
+            if (!valid(target)) continue;
+
+            result.push_back(Symbol {
+                .addr = target,
+                .size = 0,
+                .module = module,
+                .name = "LVO-" + std::to_string(lvo) });
+        }
+    }
+
+    // Collect the address ranges of all resident modules
+    auto modules = lists.execBase.ResModules;
+    for (isize i = 0; valid(modules) && i < 256; i++, modules += 4) {
+
+        auto tag = mem.spypeek32 <ACCESSOR_CPU> (modules);
+        if (tag == 0) break;
+
+        // A set MSB indicates a link to another table
+        if (tag & 0x80000000) { modules = (tag & 0x7FFFFFFF) - 4; continue; }
+
+        if (!valid(tag) || mem.spypeek16 <ACCESSOR_CPU> (tag) != 0x4AFC) continue;
+
+        auto endSkip = mem.spypeek32 <ACCESSOR_CPU> (tag + 6);
+        if (endSkip <= tag) continue;
+
+        result.push_back(Symbol {
+            .addr = tag,
+            .size = endSkip - tag,
+            .module = name(mem.spypeek32 <ACCESSOR_CPU> (tag + 14)),
+            .name = "" });
+    }
+
+    std::sort(result.begin(), result.end(), [](const Symbol &a, const Symbol &b) {
+        return a.addr < b.addr;
+    });
+
+    return result;
+}
+
+string
+GuestProfiler::symbolize(const std::vector<Symbol> &symbols, u64 key) const
+{
+    auto pc = u32(key >> 32);
+    auto task = u32(key);
+
+    auto offset = [](u32 value) {
+        std::stringstream ss; ss << "+0x" << std::hex << value; return ss.str();
+    };
+
+    // First frame: The running task
+    string result;
+
+    if (task == 0) {
+
+        result = "Supervisor";
+
+    } else {
+
+        os::Task tc;
+        if (amiga.osDebugger.searchTask(task, tc)) {
+
+            amiga.osDebugger.read(tc.tc_Node.ln_Name, result, 64);
+            std::replace(result.begin(), result.end(), ';', '_');
+        }
+        if (result.empty()) result = "Task" + offset(task).substr(1);
+    }
+
+    // Second and third frame: Module and location
+    const Symbol *hunk = nullptr, *function = nullptr, *module = nullptr;
+
+    for (auto &s : symbols) {
+
+        if (s.addr > pc) break;
+
+        if (s.size == 0) {
+            function = &s;
+        } else if (pc - s.addr < s.size) {
+            (s.name.empty() ? module : hunk) = &s;
+        }
+    }
+
+    // Only accept functions which are close enough
+    if (function && pc - function->addr >= 0x4000) function = nullptr;
+
+    if (hunk) {
+        result += ";" + hunk->module + ";" + hunk->name + offset(pc - hunk->addr);
+    } else if (function) {
+        result += ";" + function->module + ";" + function->name + offset(pc - function->addr);
+    } else if (module) {
+        result += ";" + module->module + ";" + offset(pc - module->addr);
+    } else {
+        result += ";???;" + offset(pc).substr(1);
+    }
+
+    return result;
+}
+
+void
+GuestProfiler::dump(std::ostream &os, isize max) const
+{
+    auto entries = sorted();
+    auto symbols = collectSymbols();
+    auto sum = total();
+
+    os << util::tab("Profiler");
+    os << util::bol(running, "Running", "Stopped") << std::endl;
+    os << util::tab("Mode");
+    os << (interval ? "Sampling every " + std::to_string(interval) + " cycles" : "Exact") << std::endl;
+    os << util::tab("Locations");
+    os << util::dec(used) << std::endl;
+    os << util::tab("Cycles");
+    os << util::dec(sum) << std::endl;
+
+    if (entries.empty()) return;
+    os << std::endl;
+
+    for (isize i = 0; i < max && i < isize(entries.size()); i++) {
+
+        auto share = 100.0 * double(entries[i].cycles) / double(sum);
+
+        os << std::fixed << std::setprecision(2) << std::setw(6) << share << " %  ";
+        os << util::hex(u32(entries[i].key >> 32)) << "  ";
+        os << symbolize(symbols, entries[i].key) << std::endl;
+    }
+}
+
+void
+GuestProfiler::exportCollapsed(std::ostream &os) const
+{
+    auto symbols = collectSymbols();
+
+    for (auto &entry : sorted()) {
+        os << symbolize(symbols, entry.key) << " " << entry.cycles << std::endl;
+    }
+}
+
+void
+GuestProfiler::saveProfile(const std::filesystem::path &path) const
+{
+    std::ofstream stream(path);
+    if (!stream.is_open()) throw Error(VAERROR_FILE_CANT_CREATE, path.string());
+
+    exportCollapsed(stream);
+    if (!stream) throw Error(VAERROR_FILE_CANT_WRITE, path.string());
+}
+
+}
@@ -0,0 +1,157 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the Mozilla Public License v2
+//
+// See https://mozilla.org/MPL/2.0 for license information
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "BasicTypes.h"
+#include "Exception.h"
+#include <filesystem>
+#include <ostream>
+#include <vector>
+
+namespace vamiga {
+
+class Amiga;
+
+/* The guest profiler determines where the emulated CPU spends its cycles. It
+ * is called after each instruction while it is running and operates in one of
+ * two modes:
+ *
+ * - Exact mode (interval = 0)
+ *
+ *   The cycles consumed by each instruction are charged to its address.
+ *
+ * - Sampling mode (interval > 0)
+ *
+ *   The program counter is sampled every 'interval' CPU cycles. Each sample
+ *   is charged with all sampling periods that have passed since the previous
+ *   sample, so long instructions are not undercounted.
+ *
+ * Samples are keyed by the program counter and the currently running task and
+ * stored in an open-addressing hash table. Symbolization is deferred until
+ * the profile is exported. At that point, addresses are mapped to the hunks
+ * of all loaded processes, to the jump tables of all libraries and devices,
+ * and to the resident modules in Rom. Because the mapping is based on the
+ * OS structures at export time, code of processes that have already quit
+ * shows up with raw addresses.
+ */
+class GuestProfiler {
+
+    struct Entry {
+
+        // Program counter (upper 32 bits) and task pointer (lower 32 bits)
+        u64 key;
+
+        // Number of consumed CPU cycles
+        i64 cycles;
+    };
+
+    struct Symbol {
+
+        // Memory area covered by this symbol (size 0 = up to the next symbol)
+        u32 addr;
+        u32 size;
+
+        // First and second stack frame (e.g., process name and hunk number)
+        string module;
+        string name;
+    };
+
+    // Marks an unused hash table entry (PCs are never odd)
+    static constexpr u64 empty = ~u64(0);
+
+    // Reference to the profiled Amiga
+    Amiga &amiga;
+
+    // Hash table (the size is always a power of two)
+    std::vector<Entry> table;
+
+    // Number of used hash table entries
+    isize used = 0;
+
+    // Sampling interval in CPU cycles (0 = exact mode)
+    i64 interval = 0;
+
+    // Indicates if the profiler is running
+    bool running = false;
+
+    // Key and CPU clock of the most recent sample
+    u64 lastKey = empty;
+    i64 lastClock = 0;
+
+
+    //
+    // Initializing
+    //
+
+public:
+
+    GuestProfiler(Amiga& ref);
+
+    // Deletes all samples
+    void clear();
+
+
+    //
+    // Controlling
+    //
+
+public:
+
+    // Starts or stops profiling
+    void start(i64 interval = 0);
+    void stop();
+
+    bool isRunning() const { return running; }
+
+    // Takes a sample (called after each instruction while running)
+    void record();
+
+private:
+
+    // Computes the hash table key for the current CPU state
+    u64 currentKey() const;
+
+    // Charges cycles to a key
+    void add(u64 key, i64 cycles);
+
+    // Doubles the size of the hash table
+    void grow();
+
+
+    //
+    // Analyzing
+    //
+
+public:
+
+    // Returns the number of profiled locations and the number of cycles
+    isize count() const { return used; }
+    i64 total() const;
+
+    // Prints the most expensive locations
+    void dump(std::ostream &os, isize max = 20) const;
+
+    // Writes all samples in the collapsed stack format used by flame graphs
+    void exportCollapsed(std::ostream &os) const;
+    void saveProfile(const std::filesystem::path &path) const throws;
+
+private:
+
+    // Returns all entries sorted by cost
+    std::vector<Entry> sorted() const;
+
+    // Collects symbol information from the OS structures
+    std::vector<Symbol> collectSymbols() const;
+
+    // Translates a hash table key into a list of stack frames
+    string symbolize(const std::vector<Symbol> &symbols, u64 key) const;
+};
+
+}
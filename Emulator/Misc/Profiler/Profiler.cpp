@@ -0,0 +1,223 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the Mozilla Public License v2
+//
+// See https://mozilla.org/MPL/2.0 for license information
+// -----------------------------------------------------------------------------
+
+#include "config.h"
+#include "Profiler.h"
+#include "IOUtils.h"
+#include <algorithm>
+#include <bit>
+#include <iomanip>
+
+namespace vamiga {
+
+void
+Profiler::beginFrame()
+{
+    active = enableRequest;
+
+    if (active) {
+
+        // The CPU is the outermost scope
+        stack[0] = PROF_CPU;
+        depth = 1;
+        stamp = util::Time::now().asNanoseconds();
+    }
+}
+
+void
+Profiler::endFrame()
+{
+    auto clear = resetRequest.exchange(false);
+    if (!active && !clear) return;
+
+    if (active) charge();
+
+    // Signal readers that an update is in progress
+    auto seq = sequence.load(std::memory_order_relaxed);
+    sequence.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    if (clear) {
+
+        frames.store(0, std::memory_order_relaxed);
+        for (isize i = 0; i < PROF_COUNT; i++) {
+
+            lastFrame[i].store(0, std::memory_order_relaxed);
+            total[i].store(0, std::memory_order_relaxed);
+            for (isize b = 0; b < PROF_BUCKETS; b++) histogram[i][b].store(0, std::memory_order_relaxed);
+        }
+        for (isize b = 0; b < PROF_BUCKETS; b++) frameHistogram[b].store(0, std::memory_order_relaxed);
+    }
+
+    if (active) {
+
+        auto increment = [](std::atomic<i64> &counter, i64 value) {
+            counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+        };
+
+        i64 sum = 0;
+        increment(frames, 1);
+        for (isize i = 0; i < PROF_COUNT; i++) {
+
+            auto value = current[i];
+            lastFrame[i].store(value, std::memory_order_relaxed);
+            increment(total[i], value);
+            if (value) increment(histogram[i][bucket(value)], 1);
+            sum += value;
+            current[i] = 0;
+        }
+        increment(frameHistogram[bucket(sum)], 1);
+    }
+
+    // Signal readers that the update is complete
+    sequence.store(seq + 2, std::memory_order_release);
+}
+
+void
+Profiler::getStats(ProfilerStats &result) const
+{
+    u64 seq1, seq2;
+
+    do {
+
+        seq1 = sequence.load(std::memory_order_acquire);
+
+        result.frames = frames.load(std::memory_order_relaxed);
+        for (isize i = 0; i < PROF_COUNT; i++) {
+
+            result.lastFrame[i] = lastFrame[i].load(std::memory_order_relaxed);
+            result.total[i] = total[i].load(std::memory_order_relaxed);
+            for (isize b = 0; b < PROF_BUCKETS; b++) {
+                result.histogram[i][b] = histogram[i][b].load(std::memory_order_relaxed);
+            }
+        }
+        for (isize b = 0; b < PROF_BUCKETS; b++) {
+            result.frameHistogram[b] = frameHistogram[b].load(std::memory_order_relaxed);
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        seq2 = sequence.load(std::memory_order_relaxed);
+
+    } while ((seq1 & 1) || seq1 != seq2);
+
+    result.enabled = enableRequest;
+}
+
+void
+Profiler::dump(std::ostream &os) const
+{
+    using namespace util;
+
+    ProfilerStats stats;
+    getStats(stats);
+
+    os << tab("Profiler");
+    os << bol(stats.enabled, "Enabled", "Disabled") << std::endl;
+    os << tab("Profiled frames");
+    os << dec(stats.frames) << std::endl;
+
+    if (stats.frames == 0) return;
+
+    // Sort all scopes by the time spent in them
+    i64 sum = 0;
+    isize order[PROF_COUNT];
+    for (isize i = 0; i < PROF_COUNT; i++) { order[i] = i; sum += stats.total[i]; }
+    std::sort(order, order + PROF_COUNT, [&](isize a, isize b) {
+        return stats.total[a] > stats.total[b];
+    });
+
+    os << tab("Time per frame");
+    os << flt(double(sum) / stats.frames / 1000.0) << " usec" << std::endl;
+    os << tab("90% of all frames");
+    os << bucketName(percentile(stats.frameHistogram, stats.frames, 0.9)) << std::endl;
+    os << std::endl;
+
+    for (isize i = 0; i < PROF_COUNT; i++) {
+
+        auto scope = order[i];
+        if (stats.total[scope] == 0) break;
+
+        auto avg = double(stats.total[scope]) / stats.frames / 1000.0;
+        auto last = double(stats.lastFrame[scope]) / 1000.0;
+        auto share = 100.0 * double(stats.total[scope]) / double(sum);
+
+        os << tab(string(ProfilerScopeEnum::key(scope)));
+        os << std::fixed << std::setprecision(1);
+        os << std::setw(9) << avg << " usec  (last: ";
+        os << std::setw(9) << last << " usec)  ";
+        os << std::setw(5) << share << " %" << std::endl;
+    }
+}
+
+void
+Profiler::dumpHistogram(std::ostream &os) const
+{
+    using namespace util;
+
+    ProfilerStats stats;
+    getStats(stats);
+
+    os << tab("Profiled frames");
+    os << dec(stats.frames) << std::endl;
+
+    if (stats.frames == 0) return;
+
+    os << std::endl;
+    for (isize b = 0; b < PROF_BUCKETS; b++) {
+
+        auto count = stats.frameHistogram[b];
+        if (count == 0) continue;
+
+        auto share = 100.0 * double(count) / double(stats.frames);
+        auto bar = isize(share / 2.5 + 0.5);
+
+        os << tab(bucketName(b));
+        os << std::fixed << std::setprecision(1) << std::setw(5) << share << " %  ";
+        os << string(bar, '*') << std::endl;
+    }
+}
+
+isize
+Profiler::bucket(i64 ns)
+{
+    auto usec = u64(std::max(ns, i64(0)) / 1000);
+    auto bits = isize(std::bit_width(usec));
+
+    // Split each octave [2^(bits-1);2^bits) at 3 * 2^(bits-2)
+    isize result = bits <= 1 ? bits : usec < (u64(3) << (bits - 2)) ? 2 * bits - 2 : 2 * bits - 1;
+    return std::min(result, isize(PROF_BUCKETS - 1));
+}
+
+i64
+Profiler::upperBound(isize bucket)
+{
+    if (bucket >= PROF_BUCKETS - 1) return 0;
+    return bucket & 1 ? i64(1) << ((bucket + 1) / 2) : bucket ? i64(3) << (bucket / 2 - 1) : 1;
+}
+
+string
+Profiler::bucketName(isize bucket)
+{
+    auto bound = upperBound(bucket);
+    return bound ? "< " + std::to_string(bound) + " usec" : ">= " + std::to_string(upperBound(bucket - 1)) + " usec";
+}
+
+isize
+Profiler::percentile(const i64 *histogram, i64 frames, double share)
+{
+    i64 count = 0;
+    for (isize b = 0; b < PROF_BUCKETS; b++) {
+
+        count += histogram[b];
+        if (double(count) >= share * double(frames)) return b;
+    }
+    return PROF_BUCKETS - 1;
+}
+
+}
@@ -0,0 +1,150 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the Mozilla Public License v2
+//
+// See https://mozilla.org/MPL/2.0 for license information
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "ProfilerTypes.h"
+#include "Chrono.h"
+#include <atomic>
+#include <ostream>
+
+namespace vamiga {
+
+/* The profiler measures how much host time is spent in the event slots, in
+ * the CPU, and in the stages of the Denise hsync handler. Each scope is
+ * charged with its exclusive time, i.e., time spent in a nested scope is not
+ * charged to the enclosing scope. The CPU forms the outermost scope and thus
+ * receives all time that is not spent elsewhere.
+ *
+ * Measurements are collected on the emulator thread without any locking. At
+ * the end of each frame, the results are published in a set of atomic
+ * counters guarded by a sequence number. getStats() can be called from any
+ * thread and retries if it overlaps with an update. Besides the accumulated
+ * times, the profiler records how the per-frame times are distributed in a
+ * histogram with logarithmic buckets (see PROF_BUCKETS).
+ */
+class Profiler {
+
+    // Maximum nesting depth of scopes
+    static constexpr isize maxDepth = 16;
+
+    // Requests issued by other threads (evaluated at frame boundaries)
+    std::atomic<bool> enableRequest = false;
+    std::atomic<bool> resetRequest = false;
+
+public:
+
+    // Indicates if the current frame is profiled
+    bool active = false;
+
+private:
+
+    // Scopes that have been entered but not left yet
+    isize stack[maxDepth];
+    isize depth = 0;
+
+    // Host time of the most recent scope change
+    i64 stamp = 0;
+
+    // Accumulated host times of the current frame
+    i64 current[PROF_COUNT] = { };
+
+    // Published results
+    std::atomic<u64> sequence = 0;
+    std::atomic<i64> frames = 0;
+    std::atomic<i64> lastFrame[PROF_COUNT] = { };
+    std::atomic<i64> total[PROF_COUNT] = { };
+    std::atomic<i64> histogram[PROF_COUNT][PROF_BUCKETS] = { };
+    std::atomic<i64> frameHistogram[PROF_BUCKETS] = { };
+
+
+    //
+    // Controlling
+    //
+
+public:
+
+    void enable() { enableRequest = true; }
+    void disable() { enableRequest = false; }
+    void reset() { resetRequest = true; }
+    bool isEnabled() const { return enableRequest; }
+
+
+    //
+    // Measuring
+    //
+
+public:
+
+    // Called at the beginning and at the end of Amiga::computeFrame()
+    void beginFrame();
+    void endFrame();
+
+    // Opens or closes a nested scope
+    void enter(isize scope) {
+
+        if (active) {
+
+            assert(depth < maxDepth);
+            charge();
+            stack[depth++] = scope;
+        }
+    }
+    void leave() {
+
+        if (active) {
+
+            assert(depth > 1);
+            charge();
+            depth--;
+        }
+    }
+
+private:
+
+    // Charges the time since the last scope change to the innermost scope
+    void charge() {
+
+        auto now = util::Time::now().asNanoseconds();
+        current[stack[depth - 1]] += now - stamp;
+        stamp = now;
+    }
+
+
+    //
+    // Analyzing
+    //
+
+public:
+
+    // Returns a consistent copy of the published results
+    void getStats(ProfilerStats &result) const;
+
+    // Prints the published results in form of a table
+    void dump(std::ostream &os) const;
+
+    // Prints the distribution of the per-frame times
+    void dumpHistogram(std::ostream &os) const;
+
+private:
+
+    // Returns the histogram bucket for a host time
+    static isize bucket(i64 ns);
+
+    // Returns the upper bound of a histogram bucket in usec (0 = unbounded)
+    static i64 upperBound(isize bucket);
+
+    // Returns a textual description of a histogram bucket
+    static string bucketName(isize bucket);
+
+    // Returns the bucket below which the given share of all frames lies
+    static isize percentile(const i64 *histogram, i64 frames, double share);
+};
+
+}
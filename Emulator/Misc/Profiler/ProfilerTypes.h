@@ -0,0 +1,84 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the Mozilla Public License v2
+//
+// See https://mozilla.org/MPL/2.0 for license information
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "Types.h"
+#include "Reflection.h"
+#include "AgnusTypes.h"
+
+//
+// Enumerations
+//
+
+/* Profiling scopes. The first SLOT_COUNT scopes refer to the event slots
+ * serviced by Agnus. The remaining scopes refer to the CPU and to the stages
+ * of the Denise hsync handler.
+ */
+enum_long(PROF_SCOPE)
+{
+    PROF_CPU = SLOT_COUNT,          ///< CPU (everything not covered elsewhere)
+    PROF_TRANSLATE,                 ///< Denise: Bitplane translation
+    PROF_SPRITES,                   ///< Denise: Sprite drawing
+    PROF_COLORIZE,                  ///< Denise: Color synthesis
+
+    PROF_COUNT
+};
+typedef PROF_SCOPE ProfilerScope;
+
+#ifdef __cplusplus
+struct ProfilerScopeEnum : vamiga::util::Reflection<ProfilerScopeEnum, ProfilerScope>
+{
+    static constexpr long minVal = 0;
+    static constexpr long maxVal = PROF_COUNT - 1;
+
+    static const char *prefix() { return "PROF"; }
+    static const char *_key(long value)
+    {
+        if (value < SLOT_COUNT) return EventSlotEnum::_key(value);
+
+        switch (value) {
+
+            case PROF_CPU:          return "CPU";
+            case PROF_TRANSLATE:    return "TRANSLATE";
+            case PROF_SPRITES:      return "SPRITES";
+            case PROF_COLORIZE:     return "COLORIZE";
+            case PROF_COUNT:        return "???";
+        }
+        return "???";
+    }
+};
+#endif
+
+
+//
+// Constants
+//
+
+/* Number of histogram buckets. The buckets are half an octave wide. Their
+ * upper bounds are 1, 2, 3, 4, 6, 8, 12, 16, ... usec. The last bucket also
+ * counts all longer frames.
+ */
+static constexpr long PROF_BUCKETS = 32;
+
+
+//
+// Structures
+//
+
+typedef struct
+{
+    bool enabled;                   ///< Indicates if the profiler is running
+    i64 frames;                     ///< Number of profiled frames
+    i64 lastFrame[PROF_COUNT];      ///< Host time spent in the last frame (ns)
+    i64 total[PROF_COUNT];          ///< Host time spent in all frames (ns)
+    i64 histogram[PROF_COUNT][PROF_BUCKETS]; ///< Frames per time bucket
+    i64 frameHistogram[PROF_BUCKETS];        ///< Frames per total time bucket
+}
+ProfilerStats;
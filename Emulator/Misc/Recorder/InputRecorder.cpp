@@ -0,0 +1,432 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the Mozilla Public License v2
+//
+// See https://mozilla.org/MPL/2.0 for license information
+// -----------------------------------------------------------------------------
+
+#include "config.h"
+#include "InputRecorder.h"
+#include "Amiga.h"
+#include "Snapshot.h"
+#include <bit>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+
+namespace vamiga {
+
+//
+// Variable-length encoding
+//
+
+static void
+putVarint(std::vector<u8> &buf, u64 value)
+{
+    while (value >= 0x80) { buf.push_back(u8(value | 0x80)); value >>= 7; }
+    buf.push_back(u8(value));
+}
+
+static void
+putDouble(std::vector<u8> &buf, double value)
+{
+    putVarint(buf, SWAP64(std::bit_cast<u64>(value)));
+}
+
+static u64
+getVarint(const u8 *&p, const u8 *end)
+{
+    u64 result = 0;
+
+    for (isize shift = 0; shift < 64; shift += 7) {
+
+        if (p == end) throw Error(VAERROR_FILE_TYPE_MISMATCH);
+
+        u8 byte = *p++;
+        result |= u64(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) return result;
+    }
+    throw Error(VAERROR_FILE_TYPE_MISMATCH);
+}
+
+static double
+getDouble(const u8 *&p, const u8 *end)
+{
+    return std::bit_cast<double>(SWAP64(getVarint(p, end)));
+}
+
+
+//
+// Initializing
+//
+
+InputRecorder::InputRecorder(Amiga& ref) : amiga(ref) { }
+
+InputRecorder::~InputRecorder() { }
+
+
+//
+// Querying
+//
+
+bool
+InputRecorder::isInput(const Cmd &cmd)
+{
+    switch (cmd.type) {
+
+        case CMD_KEY_PRESS:
+        case CMD_KEY_RELEASE:
+        case CMD_KEY_RELEASE_ALL:
+        case CMD_KEY_TOGGLE:
+        case CMD_MOUSE_MOVE_ABS:
+        case CMD_MOUSE_MOVE_REL:
+        case CMD_MOUSE_EVENT:
+        case CMD_JOY_EVENT:
+        case CMD_DSK_TOGGLE_WP:
+        case CMD_DSK_MODIFIED:
+        case CMD_DSK_UNMODIFIED:
+
+            return true;
+
+        default:
+
+            return false;
+    }
+}
+
+isize
+InputRecorder::count() const
+{
+    SYNCHRONIZED
+
+    return isize(events.size());
+}
+
+Cycle
+InputRecorder::duration() const
+{
+    SYNCHRONIZED
+
+    return snapshot ? endCycle : 0;
+}
+
+i64
+InputRecorder::hostTime() const
+{
+    return startTime + i64(AS_SEC(amiga.agnus.clock - startCycle));
+}
+
+
+//
+// Recording
+//
+
+void
+InputRecorder::startRecording()
+{
+    SYNCHRONIZED
+
+    events.clear();
+    snapshot = std::make_unique<Snapshot>(amiga);
+    snapshot->compress();
+    endCycle = amiga.agnus.clock;
+    endChecksum = 0;
+    startTime = i64(time(nullptr));
+    startCycle = amiga.agnus.clock;
+
+    replaying = false;
+    recording = true;
+}
+
+void
+InputRecorder::stopRecording()
+{
+    SYNCHRONIZED
+
+    if (recording) {
+
+        endCycle = amiga.agnus.clock;
+        endChecksum = stateChecksum();
+        recording = false;
+    }
+}
+
+void
+InputRecorder::record(const Cmd &cmd)
+{
+    SYNCHRONIZED
+
+    if (recording && isInput(cmd)) {
+        events.push_back(Event { .cycle = amiga.agnus.clock, .cmd = cmd });
+    }
+}
+
+
+//
+// Replaying
+//
+
+void
+InputRecorder::startReplay()
+{
+    SYNCHRONIZED
+
+    if (!snapshot) return;
+
+    recording = false;
+    replaying = false;
+
+    // Revert to the initial state of the movie
+    amiga.loadSnapshot(*snapshot);
+    startCycle = amiga.agnus.clock;
+
+    next = 0;
+    due = events.empty() ? endCycle : events[0].cycle;
+    replaying = true;
+}
+
+void
+InputRecorder::stopReplay()
+{
+    SYNCHRONIZED
+
+    replaying = false;
+    due = NEVER;
+}
+
+bool
+InputRecorder::poll(Cmd &cmd)
+{
+    SYNCHRONIZED
+
+    if (!replaying) return false;
+
+    auto clock = amiga.agnus.clock;
+
+    if (next < isize(events.size())) {
+
+        if (events[next].cycle > clock) return false;
+
+        cmd = events[next++].cmd;
+        due = next < isize(events.size()) ? events[next].cycle : endCycle;
+        return true;
+    }
+
+    if (clock >= endCycle) finishReplay();
+    return false;
+}
+
+void
+InputRecorder::finishReplay()
+{
+    replaying = false;
+    due = NEVER;
+
+    // Report if the replay ended in the same state as the recording
+    auto match = amiga.agnus.clock == endCycle && stateChecksum() == endChecksum;
+    amiga.msgQueue.put(MSG_REPLAY_FINISHED, match);
+}
+
+u64
+InputRecorder::stateChecksum() const
+{
+    /* The Amiga class itself only stores host-side settings such as the warp
+     * mode, which may differ between recording and replay. Hence, only the
+     * subcomponents are taken into account.
+     */
+    u64 result = util::fnvInit64();
+    for (auto &c : amiga.subComponents) result = util::fnvIt64(result, c->checksum(true));
+
+    return result;
+}
+
+
+//
+// Loading and saving
+//
+
+void
+InputRecorder::saveMovie(const std::filesystem::path &path) const
+{
+    SYNCHRONIZED
+
+    if (!snapshot || recording) throw Error(VAERROR_FILE_CANT_WRITE, path.string());
+
+    // Encode all events
+    std::vector<u8> buf;
+    Cycle cycle = 0;
+
+    for (auto &event : events) {
+
+        auto &cmd = event.cmd;
+
+        putVarint(buf, u64(event.cycle - cycle));
+        buf.push_back(u8(cmd.type));
+        cycle = event.cycle;
+
+        switch (cmd.type) {
+
+            case CMD_KEY_PRESS:
+            case CMD_KEY_RELEASE:
+            case CMD_KEY_RELEASE_ALL:
+            case CMD_KEY_TOGGLE:
+
+                putVarint(buf, u64(cmd.key.keycode));
+                putDouble(buf, cmd.key.delay);
+                break;
+
+            case CMD_MOUSE_MOVE_ABS:
+            case CMD_MOUSE_MOVE_REL:
+
+                putVarint(buf, u64(cmd.coord.port));
+                putDouble(buf, cmd.coord.x);
+                putDouble(buf, cmd.coord.y);
+                break;
+
+            case CMD_MOUSE_EVENT:
+            case CMD_JOY_EVENT:
+
+                putVarint(buf, u64(cmd.action.port));
+                putVarint(buf, u64(cmd.action.action));
+                putDouble(buf, cmd.action.delay);
+                break;
+
+            default:
+
+                putVarint(buf, u64(cmd.value));
+                break;
+        }
+    }
+
+    std::ofstream stream(path, std::ios::binary);
+    if (!stream.is_open()) throw Error(VAERROR_FILE_CANT_CREATE, path.string());
+
+    auto snpSize = u64(snapshot->data.size);
+    auto numEvents = u64(events.size());
+    auto end = u64(endCycle);
+
+    stream.write(magic, 7);
+    stream.write((const char *)&version, sizeof(version));
+    stream.write((const char *)&snpSize, sizeof(snpSize));
+    stream.write((const char *)snapshot->data.ptr, snpSize);
+    stream.write((const char *)&numEvents, sizeof(numEvents));
+    stream.write((const char *)&end, sizeof(end));
+    stream.write((const char *)&endChecksum, sizeof(endChecksum));
+    stream.write((const char *)&startTime, sizeof(startTime));
+    stream.write((const char *)buf.data(), buf.size());
+
+    if (!stream) throw Error(VAERROR_FILE_CANT_WRITE, path.string());
+}
+
+void
+InputRecorder::loadMovie(const std::filesystem::path &path)
+{
+    SYNCHRONIZED
+
+    std::ifstream stream(path, std::ios::binary);
+    if (!stream.is_open()) throw Error(VAERROR_FILE_NOT_FOUND, path.string());
+
+    // Read the header
+    char id[7];
+    u8 ver = 0;
+    u64 snpSize = 0;
+    stream.read(id, 7);
+    stream.read((char *)&ver, sizeof(ver));
+    stream.read((char *)&snpSize, sizeof(snpSize));
+
+    if (!stream || memcmp(id, magic, 7) != 0 || ver != version || snpSize > u64(MB(64))) {
+        throw Error(VAERROR_FILE_TYPE_MISMATCH);
+    }
+
+    // Read the initial state
+    std::vector<u8> snp(snpSize);
+    stream.read((char *)snp.data(), snpSize);
+    if (!stream) throw Error(VAERROR_FILE_CANT_READ, path.string());
+    auto newSnapshot = std::make_unique<Snapshot>(snp.data(), isize(snpSize));
+
+    // Read the events
+    u64 numEvents = 0, end = 0, hash = 0;
+    i64 start = 0;
+    stream.read((char *)&numEvents, sizeof(numEvents));
+    stream.read((char *)&end, sizeof(end));
+    stream.read((char *)&hash, sizeof(hash));
+    stream.read((char *)&start, sizeof(start));
+    if (!stream) throw Error(VAERROR_FILE_CANT_READ, path.string());
+
+    std::vector<u8> buf((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+    auto p = (const u8 *)buf.data();
+    auto e = p + buf.size();
+
+    std::vector<Event> newEvents;
+    Cycle cycle = 0;
+
+    for (u64 i = 0; i < numEvents; i++) {
+
+        cycle += Cycle(getVarint(p, e));
+        if (p == e) throw Error(VAERROR_FILE_TYPE_MISMATCH);
+
+        Cmd cmd(CmdType(*p++));
+
+        switch (cmd.type) {
+
+            case CMD_KEY_PRESS:
+            case CMD_KEY_RELEASE:
+            case CMD_KEY_RELEASE_ALL:
+            case CMD_KEY_TOGGLE:
+            {
+                auto keycode = getVarint(p, e);
+                if (keycode >= 128) throw Error(VAERROR_FILE_TYPE_MISMATCH);
+
+                cmd.key.keycode = KeyCode(keycode);
+                cmd.key.delay = getDouble(p, e);
+                break;
+            }
+
+            case CMD_MOUSE_MOVE_ABS:
+            case CMD_MOUSE_MOVE_REL:
+
+                cmd.coord.port = isize(getVarint(p, e));
+                cmd.coord.x = getDouble(p, e);
+                cmd.coord.y = getDouble(p, e);
+                break;
+
+            case CMD_MOUSE_EVENT:
+            case CMD_JOY_EVENT:
+
+                cmd.action.port = isize(getVarint(p, e));
+                cmd.action.action = GamePadAction(getVarint(p, e));
+                cmd.action.delay = getDouble(p, e);
+
+                if (!GamePadActionEnum::isValid(cmd.action.action)) throw Error(VAERROR_FILE_TYPE_MISMATCH);
+                break;
+
+            case CMD_DSK_TOGGLE_WP:
+            case CMD_DSK_MODIFIED:
+            case CMD_DSK_UNMODIFIED:
+
+                cmd.value = i64(getVarint(p, e));
+
+                if (u64(cmd.value) >= 4) throw Error(VAERROR_FILE_TYPE_MISMATCH);
+                break;
+
+            default:
+
+                throw Error(VAERROR_FILE_TYPE_MISMATCH);
+        }
+
+        newEvents.push_back(Event { .cycle = cycle, .cmd = cmd });
+    }
+
+    recording = false;
+    replaying = false;
+    due = NEVER;
+    snapshot = std::move(newSnapshot);
+    events = std::move(newEvents);
+    endCycle = Cycle(end);
+    endChecksum = hash;
+    startTime = start;
+}
+
+}
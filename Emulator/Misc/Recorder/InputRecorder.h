@@ -0,0 +1,178 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the Mozilla Public License v2
+//
+// See https://mozilla.org/MPL/2.0 for license information
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "AgnusTypes.h"
+#include "BasicTypes.h"
+#include "CmdQueueTypes.h"
+#include "Exception.h"
+#include "Synchronizable.h"
+#include <filesystem>
+#include <memory>
+#include <vector>
+
+namespace vamiga {
+
+class Amiga;
+class Snapshot;
+
+/* The input recorder logs all externally injected input events (keyboard,
+ * mouse, joystick, and floppy drive commands) together with the value of the
+ * Agnus clock at the time they were processed. Together with a snapshot of
+ * the emulator state at the beginning of the recording, the log forms a
+ * "movie" which reproduces the recorded session bit-exactly when replayed.
+ *
+ * Movie file layout:
+ *
+ *     "VAMOVIE" | version (1 byte) | snapshot size (8 bytes) | snapshot |
+ *     number of events (8 bytes) | end cycle (8 bytes) | end checksum (8 bytes) |
+ *     start time (8 bytes) | events
+ *
+ * Each event is stored as the variable-length encoded cycle difference to
+ * the previous event, the command type (1 byte), and a variable-length
+ * encoded payload. Floating-point values are stored with their bytes
+ * reversed which makes small integral values fit into one or two bytes.
+ *
+ * While a movie is recorded or replayed, the real-time clock does not query
+ * the host machine. It derives the time from the Agnus clock instead, starting
+ * at the host time when the recording began.
+ */
+class InputRecorder {
+
+    struct Event {
+
+        // Value of the Agnus clock when the command was processed
+        Cycle cycle;
+
+        // The recorded command
+        Cmd cmd;
+    };
+
+    // File format identification
+    static constexpr const char *magic = "VAMOVIE";
+    static constexpr u8 version = 3;
+
+    // Reference to the recorded Amiga
+    Amiga &amiga;
+
+    // Emulator state at the beginning of the recording
+    std::unique_ptr<Snapshot> snapshot;
+
+    // Recorded events (in ascending cycle order)
+    std::vector<Event> events;
+
+    // The movie ends at this cycle with this emulator state checksum
+    Cycle endCycle = 0;
+    u64 endChecksum = 0;
+
+    // Host time (seconds since the epoch) and Agnus clock at the beginning
+    i64 startTime = 0;
+    Cycle startCycle = 0;
+
+    // Current state
+    bool recording = false;
+    bool replaying = false;
+
+    // Index of the next event to replay
+    isize next = 0;
+
+    // Cycle at which poll() needs to be called next (NEVER if not replaying)
+    Cycle due = NEVER;
+
+    // Protects all members from concurrent access
+    mutable util::ReentrantMutex mutex;
+
+
+    //
+    // Initializing
+    //
+
+public:
+
+    InputRecorder(Amiga& ref);
+    ~InputRecorder();
+
+
+    //
+    // Querying
+    //
+
+public:
+
+    // Checks if a command is recorded
+    static bool isInput(const Cmd &cmd);
+
+    bool isRecording() const { return recording; }
+    bool isReplaying() const { return replaying; }
+
+    // Returns the number of recorded events
+    isize count() const;
+
+    // Returns the cycle at which the movie ends
+    Cycle duration() const;
+
+    // Returns the host time as seen by the recorded or replayed session
+    i64 hostTime() const;
+
+
+    //
+    // Recording
+    //
+
+public:
+
+    // Starts a new recording at the current emulator state
+    void startRecording();
+
+    // Finishes the recording
+    void stopRecording();
+
+    // Logs a command (called when the command is processed)
+    void record(const Cmd &cmd);
+
+
+    //
+    // Replaying
+    //
+
+public:
+
+    // Restores the initial state of the movie and starts replaying
+    void startReplay() throws;
+
+    // Stops replaying
+    void stopReplay();
+
+    // Checks if poll() has something to do
+    bool isDue(Cycle clock) const { return clock >= due; }
+
+    // Returns the next due event (returns false if no event is due)
+    bool poll(Cmd &cmd);
+
+private:
+
+    // Called when the end of the movie has been reached
+    void finishReplay();
+
+    // Computes a checksum of the emulated machine state
+    u64 stateChecksum() const;
+
+
+    //
+    // Loading and saving
+    //
+
+public:
+
+    void saveMovie(const std::filesystem::path &path) const throws;
+    void loadMovie(const std::filesystem::path &path) throws;
+};
+
+}
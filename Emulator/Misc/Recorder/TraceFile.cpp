@@ -0,0 +1,260 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the Mozilla Public License v2
+//
+// See https://mozilla.org/MPL/2.0 for license information
+// -----------------------------------------------------------------------------
+
+#include "config.h"
+#include "TraceFile.h"
+#include "Error.h"
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace vamiga {
+
+//
+// TraceWriter
+//
+
+TraceWriter::~TraceWriter()
+{
+    close();
+}
+
+void
+TraceWriter::open(const std::filesystem::path &path, isize bytes, u8 cpuModel, u8 dasmModel)
+{
+    close();
+
+    auto count = std::max(isize(1), (bytes - trace::headerSize) / trace::blockSize);
+    auto total = trace::headerSize + count * trace::blockSize;
+
+#ifdef _WIN32
+
+    throw Error(VAERROR_FILE_CANT_CREATE, path.string());
+
+#else
+
+    fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd == -1) throw Error(VAERROR_FILE_CANT_CREATE, path.string());
+
+    if (::ftruncate(fd, total) == -1) {
+
+        ::close(fd);
+        fd = -1;
+        throw Error(VAERROR_FILE_CANT_WRITE, path.string());
+    }
+
+    auto ptr = ::mmap(nullptr, total, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (ptr == MAP_FAILED) {
+
+        ::close(fd);
+        fd = -1;
+        throw Error(VAERROR_FILE_CANT_WRITE, path.string());
+    }
+
+    base = (u8 *)ptr;
+
+#endif
+
+    size = total;
+    blockCount = count;
+
+    trace::Header header = {
+        .magic = { 'V', 'A', 'T', 'R', 'A', 'C', 'E' },
+        .version = trace::version,
+        .cpuModel = cpuModel,
+        .dasmModel = dasmModel,
+        .pad = { },
+        .blockCount = u32(count),
+        .sequence = 0
+    };
+    std::memcpy(base, &header, sizeof(header));
+
+    // Start with the first block
+    block = -1;
+    sequence = 0;
+    nextBlock();
+}
+
+void
+TraceWriter::close()
+{
+    if (!base) return;
+
+    // Record the sequence number of the last block
+    std::memcpy(base + offsetof(trace::Header, sequence), &sequence, sizeof(sequence));
+
+#ifndef _WIN32
+
+    ::munmap(base, size);
+    ::close(fd);
+
+#endif
+
+    base = nullptr;
+    fd = -1;
+}
+
+isize
+TraceWriter::written() const
+{
+    if (!base) return 0;
+
+    auto full = std::min(isize(sequence - 1), blockCount - 1);
+    return full * trace::blockSize + offset;
+}
+
+void
+TraceWriter::nextBlock()
+{
+    block = (block + 1) % blockCount;
+    offset = trace::blockHeaderSize;
+    sequence++;
+
+    auto p = base + trace::headerSize + block * trace::blockSize;
+    u32 used = u32(offset);
+    std::memcpy(p, &sequence, 8);
+    std::memcpy(p + 8, &used, 4);
+}
+
+void
+TraceWriter::write(const trace::Record &record)
+{
+    assert(base);
+
+    // Determine the changed registers (all of them at the start of a block)
+    u16 mask = 0xFFFF;
+    if (offset != trace::blockHeaderSize) {
+
+        mask = 0;
+        for (isize i = 0; i < 16; i++) if (record.regs[i] != regs[i]) mask |= u16(1 << i);
+    }
+
+    // Continue in the next block if the record doesn't fit
+    auto bytes = trace::recordHeaderSize + 4 * std::popcount(mask);
+    if (offset + bytes > trace::blockSize) {
+
+        nextBlock();
+        mask = 0xFFFF;
+        bytes = trace::recordHeaderSize + 4 * 16;
+    }
+
+    // Write the record
+    auto blk = base + trace::headerSize + block * trace::blockSize;
+    auto p = blk + offset;
+
+    std::memcpy(p, &record.clock, 8);
+    std::memcpy(p + 8, &record.pc, 4);
+    std::memcpy(p + 12, &record.sr, 2);
+    std::memcpy(p + 14, &mask, 2);
+    std::memcpy(p + 16, record.words, 2 * trace::maxWords);
+    p += trace::recordHeaderSize;
+
+    for (isize i = 0; i < 16; i++) {
+
+        if (mask & (1 << i)) {
+
+            std::memcpy(p, &record.regs[i], 4);
+            regs[i] = record.regs[i];
+            p += 4;
+        }
+    }
+
+    // Update the fill level
+    offset += bytes;
+    u32 used = u32(offset);
+    std::memcpy(blk + 8, &used, 4);
+}
+
+
+//
+// TraceReader
+//
+
+void
+TraceReader::open(const std::filesystem::path &path)
+{
+    std::ifstream stream(path, std::ios::binary);
+    if (!stream.is_open()) throw Error(VAERROR_FILE_NOT_FOUND, path.string());
+
+    data.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+
+    if (isize(data.size()) < trace::headerSize) throw Error(VAERROR_FILE_TYPE_MISMATCH);
+    std::memcpy(&header, data.data(), sizeof(header));
+
+    if (std::memcmp(header.magic, trace::magic, 7) != 0 ||
+        header.version != trace::version ||
+        isize(data.size()) < trace::headerSize + isize(header.blockCount) * trace::blockSize) {
+
+        throw Error(VAERROR_FILE_TYPE_MISMATCH);
+    }
+}
+
+void
+TraceReader::decode(std::function<void(const trace::Record &)> func) const
+{
+    // Collect all used blocks in chronological order
+    std::vector<std::pair<u64, const u8 *>> blocks;
+
+    for (isize i = 0; i < isize(header.blockCount); i++) {
+
+        auto p = data.data() + trace::headerSize + i * trace::blockSize;
+
+        u64 seq;
+        std::memcpy(&seq, p, 8);
+        if (seq) blocks.push_back({ seq, p });
+    }
+    std::sort(blocks.begin(), blocks.end());
+
+    for (auto &it : blocks) {
+
+        auto blk = it.second;
+
+        u32 used;
+        std::memcpy(&used, blk + 8, 4);
+        used = std::min(used, u32(trace::blockSize));
+
+        trace::Record record = { };
+
+        for (isize offset = trace::blockHeaderSize; offset + trace::recordHeaderSize <= isize(used);) {
+
+            auto p = blk + offset;
+
+            std::memcpy(&record.clock, p, 8);
+            std::memcpy(&record.pc, p + 8, 4);
+            std::memcpy(&record.sr, p + 12, 2);
+            std::memcpy(&record.mask, p + 14, 2);
+            std::memcpy(record.words, p + 16, 2 * trace::maxWords);
+            p += trace::recordHeaderSize;
+
+            auto bytes = trace::recordHeaderSize + 4 * std::popcount(record.mask);
+            if (offset + bytes > isize(used)) break;
+
+            for (isize i = 0; i < 16; i++) {
+
+                if (record.mask & (1 << i)) {
+
+                    std::memcpy(&record.regs[i], p, 4);
+                    p += 4;
+                }
+            }
+
+            func(record);
+            offset += bytes;
+        }
+    }
+}
+
+}
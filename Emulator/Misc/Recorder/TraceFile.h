@@ -0,0 +1,150 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the Mozilla Public License v2
+//
+// See https://mozilla.org/MPL/2.0 for license information
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "BasicTypes.h"
+#include "Exception.h"
+#include <filesystem>
+#include <functional>
+#include <vector>
+
+namespace vamiga {
+
+/* Instruction traces are stored in binary form to keep the overhead on the
+ * emulator thread low. No formatting takes place while a trace is recorded.
+ * Instead, trace files are disassembled offline (see vAmigaTrace).
+ *
+ * Trace file layout:
+ *
+ *     File header (4 KB) | block 0 | block 1 | ... | block n-1
+ *
+ * The blocks form a ring buffer. If the file is full, the writer wraps around
+ * and overwrites the oldest block. Each block starts with a sequence number
+ * and its fill level and contains a sequence of instruction records. Records
+ * never cross block boundaries. Each record has the following layout:
+ *
+ *     CPU clock (8 bytes) | PC (4 bytes) | SR (2 bytes) | register mask
+ *     (2 bytes) | instruction words (5 x 2 bytes) | register values
+ *
+ * The register mask indicates which of the registers D0 ... D7, A0 ... A7
+ * have changed since the previous record. Only the values of these registers
+ * are stored. The first record of a block stores all registers, so each block
+ * can be decoded on its own. All values are stored in host byte order.
+ */
+namespace trace {
+
+static constexpr const char *magic = "VATRACE";
+static constexpr u8 version = 1;
+
+static constexpr isize headerSize = 4096;
+static constexpr isize blockSize = 64 * 1024;
+static constexpr isize blockHeaderSize = 16;
+static constexpr isize recordHeaderSize = 26;
+static constexpr isize maxWords = 5;
+
+struct Header {
+
+    char magic[7];
+    u8 version;
+
+    // CPU model and disassembler model (CPURevision, DasmRevision)
+    u8 cpuModel;
+    u8 dasmModel;
+    u8 pad[2];
+
+    // Number of blocks in the ring buffer
+    u32 blockCount;
+
+    // Sequence number of the most recent block
+    u64 sequence;
+};
+
+struct Record {
+
+    // CPU clock when the instruction started
+    i64 clock;
+
+    // Address of the instruction and status register
+    u32 pc;
+    u16 sr;
+
+    // Registers changed since the previous record (bit n = D0 ... A7)
+    u16 mask;
+
+    // The first words of the instruction (opcode and extension words)
+    u16 words[maxWords];
+
+    // Contents of D0 ... D7, A0 ... A7 when the instruction started
+    u32 regs[16];
+};
+
+}
+
+class TraceWriter {
+
+    // Memory-mapped trace file
+    u8 *base = nullptr;
+    isize size = 0;
+    int fd = -1;
+
+    // Number of blocks in the ring buffer
+    isize blockCount = 0;
+
+    // Current block and write position inside this block
+    isize block = 0;
+    isize offset = 0;
+    u64 sequence = 0;
+
+    // Register values of the previous record
+    u32 regs[16] = { };
+
+public:
+
+    TraceWriter() { }
+    ~TraceWriter();
+
+    // Creates a trace file of the specified size and maps it into memory
+    void open(const std::filesystem::path &path, isize bytes, u8 cpuModel, u8 dasmModel) throws;
+
+    // Finalizes the header and unmaps the file
+    void close();
+
+    bool isOpen() const { return base != nullptr; }
+
+    // Returns the number of bytes written so far (capped at the file size)
+    isize written() const;
+
+    // Appends a record
+    void write(const trace::Record &record);
+
+private:
+
+    // Advances to the next block
+    void nextBlock();
+};
+
+class TraceReader {
+
+    // Contents of the trace file
+    std::vector<u8> data;
+
+public:
+
+    // File header
+    trace::Header header = { };
+
+    // Reads a trace file
+    void open(const std::filesystem::path &path) throws;
+
+    // Decodes all records in chronological order
+    void decode(std::function<void(const trace::Record &)> func) const;
+};
+
+}
@@ -47,26 +47,28 @@ GdbServer::shouldRun()
     return !segList.empty();
 }
 
-string
-GdbServer::doReceive()
+void
+GdbServer::doReceive(const string &data)
 {
-    auto cmd = connection.recv();
-    
-    // Remove LF and CR (if present)
-    cmd = util::rtrim(cmd, "\n\r");
+    // Packets may be split across or combined in a single socket read
+    inBuffer += data;
 
-    if (config.verbose) {
-        retroShell << "R: " << util::makePrintable(cmd) << "\n";
-    }
+    for (auto cmd = nextPacket(); !cmd.empty(); cmd = nextPacket()) {
 
-    latestCmd = cmd;
-    return latestCmd;
+        if (config.verbose) {
+            retroShell << "R: " << util::makePrintable(cmd) << "\n";
+        }
+
+        latestCmd = cmd;
+        RemoteServer::process(latestCmd);
+    }
 }
 
 void
 GdbServer::doSend(const string &payload)
 {
-    connection.send(payload);
+    // Data is transmitted when the packet is complete
+    connection.write(payload);
     
     if (config.verbose) {
         retroShell << "T: " << util::makePrintable(payload) << "\n";
@@ -79,6 +81,7 @@ GdbServer::doProcess(const string &payload)
     try {
         
         process(latestCmd);
+        connection.flush();
         
     } catch (Error &err) {
         
@@ -109,6 +112,7 @@ void
 GdbServer::didConnect()
 {
     ackMode = true;
+    inBuffer.clear();
 }
 
 void
@@ -121,6 +125,7 @@ GdbServer::reply(const string &payload)
     packet += computeChecksum(payload);
     
     send(packet);
+    connection.flush();
 }
 
 bool
@@ -201,6 +206,79 @@ GdbServer::verifyChecksum(const string &s, const string &chk)
     return chk == computeChecksum(s);
 }
 
+string
+GdbServer::encodeHex(const string &bytes) const
+{
+    static constexpr char digits[] = "0123456789abcdef";
+
+    string result(2 * bytes.size(), '0');
+    for (usize i = 0; i < bytes.size(); i++) {
+
+        auto byte = u8(bytes[i]);
+        result[2 * i] = digits[byte >> 4];
+        result[2 * i + 1] = digits[byte & 0xF];
+    }
+    return result;
+}
+
+string
+GdbServer::decodeHex(const string &hex) const
+{
+    auto nibble = [&](char c) {
+
+        if (c >= '0' && c <= '9') return c - '0';
+        if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+        if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+        throw Error(VAERROR_GDB_INVALID_FORMAT);
+    };
+
+    if (hex.size() % 2) throw Error(VAERROR_GDB_INVALID_FORMAT);
+
+    string result(hex.size() / 2, 0);
+    for (usize i = 0; i < result.size(); i++) {
+        result[i] = char(nibble(hex[2 * i]) << 4 | nibble(hex[2 * i + 1]));
+    }
+    return result;
+}
+
+string
+GdbServer::escape(const string &bytes) const
+{
+    string result;
+    result.reserve(bytes.size() + bytes.size() / 8);
+
+    for (auto c : bytes) {
+
+        if (c == '#' || c == '$' || c == '}' || c == '*') {
+
+            result += '}';
+            result += char(c ^ 0x20);
+
+        } else {
+
+            result += c;
+        }
+    }
+    return result;
+}
+
+string
+GdbServer::unescape(const string &data) const
+{
+    string result;
+    result.reserve(data.size());
+
+    for (usize i = 0; i < data.size(); i++) {
+
+        if (data[i] == '}' && i + 1 < data.size()) {
+            result += char(data[++i] ^ 0x20);
+        } else {
+            result += data[i];
+        }
+    }
+    return result;
+}
+
 string
 GdbServer::readRegister(isize nr)
 {
@@ -221,10 +299,76 @@ GdbServer::readRegister(isize nr)
 }
 
 string
-GdbServer::readMemory(isize addr)
+GdbServer::readMemory(isize addr, isize count)
+{
+    string result(std::clamp(count, isize(0), packetSize), 0);
+    mem.spypeek <ACCESSOR_CPU> ((u32)addr, isize(result.size()), (u8 *)result.data());
+
+    return result;
+}
+
+void
+GdbServer::writeMemory(isize addr, const string &bytes)
+{
+    SUSPENDED
+
+    for (usize i = 0; i < bytes.size(); i++) {
+        mem.patch(u32(addr + i), u8(bytes[i]));
+    }
+}
+
+void
+GdbServer::parseRange(const string &s, isize *addr, isize *count)
+{
+    auto tokens = util::split(s, ',');
+
+    if (tokens.size() != 2 ||
+        !util::parseHex(tokens[0], addr) ||
+        !util::parseHex(tokens[1], count)) {
+
+        throw Error(VAERROR_GDB_INVALID_FORMAT);
+    }
+}
+
+string
+GdbServer::memoryMap()
 {
-    auto byte = mem.spypeek8 <ACCESSOR_CPU> ((u32)addr);
-    return util::hexstr <2> (byte);
+    auto type = [&](isize bank) -> const char * {
+
+        switch (mem.cpuMemSrc[bank]) {
+
+            case MEM_NONE:          return nullptr;
+            case MEM_ROM:
+            case MEM_ROM_MIRROR:
+            case MEM_EXT:           return "rom";
+
+            default:                return "ram";
+        }
+    };
+
+    string result;
+
+    result += "<?xml version=\"1.0\"?>\n";
+    result += "<!DOCTYPE memory-map PUBLIC \"+//IDN gnu.org//DTD GDB Memory Map V1.0//EN\" ";
+    result += "\"http://sourceware.org/gdb/gdb-memory-map.dtd\">\n";
+    result += "<memory-map>\n";
+
+    // Merge adjacent banks of the same type into a single region
+    for (isize bank = 0, end; bank < 256; bank = end) {
+
+        auto t = type(bank);
+        for (end = bank + 1; end < 256 && type(end) == t; end++);
+
+        if (t) {
+
+            result += "  <memory type=\"" + string(t) + "\"";
+            result += " start=\"0x" + util::hexstr <8> (bank << 16) + "\"";
+            result += " length=\"0x" + util::hexstr <8> ((end - bank) << 16) + "\"/>\n";
+        }
+    }
+
+    result += "</memory-map>\n";
+    return result;
 }
 
 void
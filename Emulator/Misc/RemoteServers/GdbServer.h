@@ -30,11 +30,15 @@ enum class GdbCmd
     TfV,
     TfP,
     TStatus,
+    Xfer,
     fThreadInfo,
 };
 
 class GdbServer final : public RemoteServer {
 
+    // Maximum packet size announced to the client
+    static constexpr isize packetSize = 0x4000;
+
     // The name of the process to be debugged
     string processName;
     
@@ -43,6 +47,9 @@ class GdbServer final : public RemoteServer {
     
     // The most recently processed command string
     string latestCmd;
+
+    // Received data that hasn't been processed yet
+    string inBuffer;
     
     // Indicates whether received packets should be acknowledged
     bool ackMode = true;
@@ -79,7 +86,7 @@ private:
 public:
     
     bool shouldRun() override;
-    string doReceive() throws override;
+    void doReceive(const string &data) throws override;
     void doSend(const string &payload) throws override;
     void doProcess(const string &payload) throws override;
     void didStart() override;
@@ -115,6 +122,20 @@ public:
     
     // Verifies the checksum for a given string
     bool verifyChecksum(const string &s, const string &chk);
+
+
+    //
+    // Encoding data
+    //
+
+    // Converts binary data to a hex string and vice versa
+    string encodeHex(const string &bytes) const;
+    string decodeHex(const string &hex) const;
+
+    // Escapes or unescapes binary data ('X', 'x', and 'qXfer' packets)
+    string escape(const string &bytes) const;
+    string unescape(const string &data) const;
+
     
     
     //
@@ -123,6 +144,9 @@ public:
     
 public:
     
+    // Extracts the next complete packet from the input buffer
+    string nextPacket();
+
     // Processes a packet in the format used by GDB
     void process(string packet) throws;
     
@@ -146,8 +170,17 @@ private:
     // Reads a register value
     string readRegister(isize nr);
     
-    // Reads a byte from memory
-    string readMemory(isize addr);
+    // Reads a block of memory
+    string readMemory(isize addr, isize count);
+
+    // Writes a block of memory
+    void writeMemory(isize addr, const string &bytes);
+
+    // Parses the 'addr,length' part of a memory packet
+    void parseRange(const string &s, isize *addr, isize *count) throws;
+
+    // Returns the memory map in the XML format used by 'qXfer'
+    string memoryMap();
     
     
     //
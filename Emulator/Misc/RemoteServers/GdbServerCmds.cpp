@@ -31,9 +31,10 @@ GdbServer::process <' ', GdbCmd::CtrlC> (string arg)
 template <> void
 GdbServer::process <'q', GdbCmd::Supported> (string arg)
 {
-    reply("PacketSize=1ff;"
+    reply("PacketSize=" + util::hexstr <4> (packetSize) + ";"
           "multiprocess-;"
           "swbreak+;"
+          "qXfer:memory-map:read+;"
           "QStartNoAckMode+;"
           "vContSupported+");
 }
@@ -74,6 +75,43 @@ GdbServer::process <'q', GdbCmd::TfP> (string arg)
     reply("l");
 }
 
+template <> void
+GdbServer::process <'q', GdbCmd::Xfer> (string arg)
+{
+    // Format: <object>:read:<annex>:<offset>,<length>
+    auto tokens = util::split(arg, ':');
+    if (tokens.size() != 4 || tokens[1] != "read") {
+        throw Error(VAERROR_GDB_INVALID_FORMAT, "qXfer");
+    }
+
+    isize offset, length;
+    parseRange(tokens[3], &offset, &length);
+
+    string document;
+
+    if (tokens[0] == "memory-map" && tokens[2] == "") {
+
+        document = memoryMap();
+
+    } else {
+
+        reply("");
+        return;
+    }
+
+    // Transfer the requested chunk ('l' marks the last one)
+    if (offset >= isize(document.size())) {
+
+        reply("l");
+
+    } else {
+
+        auto chunk = document.substr(offset, length);
+        auto last = offset + isize(chunk.size()) >= isize(document.size());
+        reply((last ? "l" : "m") + escape(chunk));
+    }
+}
+
 template <> void
 GdbServer::process <'q', GdbCmd::fThreadInfo> (string arg)
 {
@@ -199,6 +237,11 @@ GdbServer::process <'q'> (string cmd)
         process <'q', GdbCmd::TfP> ("");
         return;
     }
+    if (command == "Xfer") {
+
+        process <'q', GdbCmd::Xfer> (cmd.substr(5));
+        return;
+    }
     if (cmd == "fThreadInfo") {
         
         process <'q', GdbCmd::fThreadInfo> ("");
@@ -303,33 +346,52 @@ GdbServer::process <'k'> (string cmd)
 template <> void
 GdbServer::process <'m'> (string cmd)
 {
-    auto tokens = util::split(cmd, ',');
-    
-    if (tokens.size() == 2) {
+    isize addr, size;
+    parseRange(cmd, &addr, &size);
+
+    reply(encodeHex(readMemory(addr, size)));
+}
 
-        string result;
+template <> void
+GdbServer::process <'M'> (string cmd)
+{
+    auto pos = cmd.find(':');
+    if (pos == string::npos) throw Error(VAERROR_GDB_INVALID_FORMAT, "M");
 
-        isize addr;
-        util::parseHex(tokens[0], &addr);
-        isize size;
-        util::parseHex(tokens[1], &size);
+    isize addr, size;
+    parseRange(cmd.substr(0, pos), &addr, &size);
 
-        for (isize i = 0; i < size; i++) {
-            result += readMemory(addr + i);
-        }
-        
-        reply(result);
+    auto data = decodeHex(cmd.substr(pos + 1));
+    if (isize(data.size()) != size) throw Error(VAERROR_GDB_INVALID_FORMAT, "M");
 
-    } else {
+    writeMemory(addr, data);
+    reply("OK");
+}
 
-        throw Error(VAERROR_GDB_UNSUPPORTED_CMD, "m");
-    }
+template <> void
+GdbServer::process <'x'> (string cmd)
+{
+    isize addr, size;
+    parseRange(cmd, &addr, &size);
+
+    reply("b" + escape(readMemory(addr, size)));
 }
 
 template <> void
-GdbServer::process <'M'> (string cmd)
+GdbServer::process <'X'> (string cmd)
 {
-    throw Error(VAERROR_GDB_UNSUPPORTED_CMD, "M");
+    // The binary data may contain any character, including ',' and ':'
+    auto pos = cmd.find(':');
+    if (pos == string::npos) throw Error(VAERROR_GDB_INVALID_FORMAT, "X");
+
+    isize addr, size;
+    parseRange(cmd.substr(0, pos), &addr, &size);
+
+    auto data = unescape(cmd.substr(pos + 1));
+    if (isize(data.size()) != size) throw Error(VAERROR_GDB_INVALID_FORMAT, "X");
+
+    writeMemory(addr, data);
+    reply("OK");
 }
 
 template <> void
@@ -404,6 +466,29 @@ GdbServer::process <'z'> (string cmd)
     }
 }
 
+string
+GdbServer::nextPacket()
+{
+    // Skip acknowledgments and line breaks between packets
+    auto start = inBuffer.find_first_not_of("+\n\r");
+    if (start == string::npos) { inBuffer.clear(); return ""; }
+
+    isize len = 1;
+
+    // Packets have the format '$...#xx'
+    if (inBuffer[start] == '$') {
+
+        // Binary data is escaped, so the first '#' terminates the packet
+        auto end = inBuffer.find('#', start);
+        if (end == string::npos || end + 2 >= inBuffer.size()) return "";
+        len = isize(end + 3 - start);
+    }
+
+    auto result = inBuffer.substr(start, len);
+    inBuffer.erase(0, start + len);
+    return result;
+}
+
 void
 GdbServer::process(string package)
 {
@@ -468,6 +553,8 @@ GdbServer::process(char cmd, string package)
         case 'k' : process <'k'> (package); break;
         case 'm' : process <'m'> (package); break;
         case 'M' : process <'M'> (package); break;
+        case 'x' : process <'x'> (package); break;
+        case 'X' : process <'X'> (package); break;
         case 'p' : process <'p'> (package); break;
         case 'P' : process <'P'> (package); break;
         case 'c' : process <'c'> (package); break;
@@ -12,6 +12,12 @@
 #include "IOUtils.h"
 #include "Agnus.h"
 #include "SerialPort.h"
+#ifdef _WIN32
+#define poll WSAPoll
+#else
+#include <fcntl.h>
+#include <poll.h>
+#endif
 
 namespace vamiga {
 
@@ -25,6 +31,26 @@ RemoteManager::RemoteManager(Amiga& ref) : SubComponent(ref)
     };
 }
 
+RemoteManager::~RemoteManager()
+{
+    {   SYNCHRONIZED quitRequest = true; }
+
+    // Terminate the I/O thread
+    if (ioThread.joinable()) {
+
+#ifndef _WIN32
+        char c = 0;
+        if (wakePipe[1] != -1) (void)::write(wakePipe[1], &c, 1);
+#endif
+        ioThread.join();
+    }
+
+#ifndef _WIN32
+    if (wakePipe[0] != -1) ::close(wakePipe[0]);
+    if (wakePipe[1] != -1) ::close(wakePipe[1]);
+#endif
+}
+
 void
 RemoteManager::_dump(Category category, std::ostream& os) const
 {
@@ -92,11 +118,147 @@ RemoteManager::numErroneous() const
     return result;
 }
 
+void
+RemoteManager::wake()
+{
+    SYNCHRONIZED
+
+    if (quitRequest) return;
+
+    // Launch the I/O thread on first use
+    if (!ioThread.joinable()) {
+
+#ifndef _WIN32
+        if (::pipe(wakePipe) == 0) {
+
+            ::fcntl(wakePipe[0], F_SETFL, O_NONBLOCK);
+            ::fcntl(wakePipe[1], F_SETFL, O_NONBLOCK);
+
+        } else {
+
+            // Fall back to polling with a timeout
+            warn("Failed to create the wake-up pipe\n");
+            wakePipe[0] = wakePipe[1] = -1;
+        }
+#endif
+        debug(SRV_DEBUG, "Launching the I/O thread\n");
+        ioThread = std::thread(&RemoteManager::ioLoop, this);
+    }
+
+#ifndef _WIN32
+    char c = 0;
+    if (wakePipe[1] != -1) (void)::write(wakePipe[1], &c, 1);
+#endif
+}
+
+void
+RemoteManager::ioLoop()
+{
+    std::vector<pollfd> fds;
+    std::vector<std::pair<RemoteServer *, bool>> owners;
+
+    while (!quitRequest) {
+
+        fds.clear();
+        owners.clear();
+        bool throttled = false;
+
+        for (auto server : servers) {
+
+            // Start or stop servers, connect or disconnect clients
+            server->handleRequests();
+
+            // Repeat announcements that didn't fit into the command queue
+            if (!server->announce()) throttled = true;
+
+            // Collect the sockets to watch
+            if (server->connection.isOpen()) {
+
+                // Leave the data in the socket if the server can't take more
+                if (server->canReceive()) {
+
+                    fds.push_back({ server->connection.getId(), POLLIN, 0 });
+                    owners.push_back({ server, false });
+
+                } else {
+
+                    throttled = true;
+                }
+
+            } else if (server->listener.isOpen()) {
+
+                fds.push_back({ server->listener.getId(), POLLIN, 0 });
+                owners.push_back({ server, true });
+            }
+        }
+
+#ifdef _WIN32
+
+        // Without a wake-up pipe, requests are recognized after the timeout
+        if (fds.empty()) {
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            continue;
+        }
+        auto timeout = throttled ? 10 : 100;
+
+#else
+
+        // Without a wake-up pipe, requests are recognized after the timeout
+        bool wakeable = wakePipe[0] != -1;
+        if (wakeable) fds.push_back({ wakePipe[0], POLLIN, 0 });
+        auto timeout = throttled ? 10 : wakeable ? -1 : 100;
+
+#endif
+
+        // Wait for socket activity
+        if (poll(fds.data(), (decltype(fds.size()))fds.size(), timeout) <= 0) continue;
+
+        for (usize i = 0; i < owners.size(); i++) {
+
+            if (!fds[i].revents) continue;
+
+            auto server = owners[i].first;
+            owners[i].second ? server->handleAccept() : server->handleInput();
+        }
+
+#ifndef _WIN32
+
+        // Empty the wake-up pipe
+        char buffer[64];
+        while (wakeable && ::read(wakePipe[0], buffer, sizeof(buffer)) > 0) { }
+
+#endif
+    }
+
+    debug(SRV_DEBUG, "I/O thread terminated\n");
+}
+
+void
+RemoteManager::processCommand(const Cmd &cmd)
+{
+    switch (cmd.type) {
+
+        case CMD_SRV_RECEIVE:
+
+            for (auto server : servers) {
+                if (server->objid == cmd.value) server->processInbox();
+            }
+            break;
+
+        default:
+            fatalError;
+    }
+}
+
 void
 RemoteManager::serviceServerEvent()
 {
     assert(agnus.id[SLOT_SRV] == SRV_LAUNCH_DAEMON);
 
+    // Process data that hasn't been announced via the command queue
+    for (auto server : servers) server->processInbox();
+
     // Run the launch daemon
     if (serServer.config.autoRun) {
         serServer.shouldRun() ? serServer._start() : serServer._stop();
@@ -11,9 +11,11 @@
 
 #include "SubComponent.h"
 #include "RemoteManagerTypes.h"
+#include "CmdQueueTypes.h"
 #include "SerServer.h"
 #include "RshServer.h"
 #include "GdbServer.h"
+#include <thread>
 
 namespace vamiga {
 
@@ -42,6 +44,21 @@ public:
         &serServer, &rshServer, &gdbServer
     };
 
+private:
+
+    /* The I/O thread. A single thread serves all remote servers. It waits
+     * for socket activity with poll() and hands received data over to the
+     * emulator thread via the command queue. The thread is launched when a
+     * server is started for the first time.
+     */
+    std::thread ioThread;
+
+    // Set to true to terminate the I/O thread
+    std::atomic<bool> quitRequest = false;
+
+    // Pipe used to interrupt poll() (unused on Windows)
+    int wakePipe[2] = { -1, -1 };
+
     
     //
     // Initializing
@@ -50,6 +67,7 @@ public:
 public:
     
     RemoteManager(Amiga& ref);
+    ~RemoteManager();
     
     RemoteManager& operator= (const RemoteManager& other) {
 
@@ -114,6 +132,31 @@ public:
     isize numErroneous() const;
 
 
+    //
+    // Running the I/O thread
+    //
+
+public:
+
+    // Launches the I/O thread if necessary and interrupts poll()
+    void wake();
+
+private:
+
+    // The I/O thread function
+    void ioLoop();
+
+
+    //
+    // Processing commands
+    //
+
+public:
+
+    // Processes a command from the command queue
+    void processCommand(const Cmd &cmd);
+
+
     //
     // Servicing events
     //
@@ -9,6 +9,7 @@
 
 #include "config.h"
 #include "RemoteServer.h"
+#include "RemoteManager.h"
 #include "Emulator.h"
 #include "CPU.h"
 #include "IOUtils.h"
@@ -106,15 +107,13 @@ RemoteServer::setOption(Option option, i64 value)
             
             if (config.port != (u16)value) {
                 
-                if (isOff()) {
+                config.port = (u16)value;
 
-                    config.port = (u16)value;
+                // Let the I/O thread reopen the server at the new port
+                if (!isOff()) {
 
-                } else {
-
-                    stop();
-                    config.port = (u16)value;
-                    start();
+                    restartRequest = true;
+                    remoteManager.wake();
                 }
             }
             return;
@@ -142,34 +141,20 @@ RemoteServer::setOption(Option option, i64 value)
 void
 RemoteServer::_start()
 {
-    if (isOff()) {
-        
+    if (!runRequest.exchange(true)) {
+
         debug(SRV_DEBUG, "Starting server...\n");
-        switchState(SRV_STATE_STARTING);
-        
-        // Make sure we continue with a terminated server thread
-        if (serverThread.joinable()) serverThread.join();
-        
-        // Spawn a new thread
-        serverThread = std::thread(&RemoteServer::main, this);
+        remoteManager.wake();
     }
 }
 
 void
 RemoteServer::_stop()
 {
-    if (!isOff()) {
-        
+    if (runRequest.exchange(false)) {
+
         debug(SRV_DEBUG, "Stopping server...\n");
-        switchState(SRV_STATE_STOPPING);
-        
-        // Interrupt the server thread
-        _disconnect();
-        
-        // Wait until the server thread has terminated
-        if (serverThread.joinable()) serverThread.join();
-        
-        switchState(SRV_STATE_OFF);
+        remoteManager.wake();
     }
 }
 
@@ -177,10 +162,9 @@ void
 RemoteServer::_disconnect()
 {
     debug(SRV_DEBUG, "Disconnecting...\n");
-    
-    // Trigger an exception inside the server thread
-    connection.close();
-    listener.close();
+
+    disconnectRequest = true;
+    remoteManager.wake();
 }
 
 void
@@ -204,23 +188,36 @@ RemoteServer::switchState(SrvState newState)
     }
 }
 
-string
-RemoteServer::receive()
+void
+RemoteServer::processInbox()
 {
-    string packet;
-    
-    if (isConnected()) {
-        
-        packet = doReceive();
-        msgQueue.put(MSG_SRV_RECEIVE, ++numReceived);
+    SYNCHRONIZED
+
+    string data;
+    std::swap(data, inbox);
+    announced = false;
+
+    if (data.empty() || !isConnected()) return;
+
+    try {
+
+        doReceive(data);
+
+    } catch (std::exception &err) {
+
+        debug(SRV_DEBUG, "Processing failed: %s\n", err.what());
+        retroShell << "Server Error: " << string(err.what()) << '\n';
+
+        // Let the I/O thread close the connection
+        _disconnect();
     }
-    
-    return packet;
 }
 
 void
 RemoteServer::send(const string &packet)
 {
+    SYNCHRONIZED
+
     if (isConnected()) {
         
         doSend(packet);
@@ -259,98 +256,156 @@ RemoteServer::send(std::stringstream &payload)
 void
 RemoteServer::process(const string &payload)
 {
+    msgQueue.put(MSG_SRV_RECEIVE, ++numReceived);
     doProcess(payload);
 }
 
 void
-RemoteServer::main()
-{    
-    try {
-        
-        mainLoop();
-        
-    } catch (std::exception &err) {
+RemoteServer::handleRequests()
+{
+    // Shut the server down if requested
+    if ((!runRequest || restartRequest) && !isOff()) {
 
-        debug(SRV_DEBUG, "Server thread interrupted\n");
-        handleError(err.what());
+        switchState(SRV_STATE_STOPPING);
+        closeSockets();
+        switchState(SRV_STATE_OFF);
     }
-}
+    restartRequest = false;
 
-void
-RemoteServer::mainLoop()
-{
-    switchState(SRV_STATE_LISTENING);
+    // Disconnect the client if requested
+    if (disconnectRequest.exchange(false) && isConnected()) {
+
+        {   SYNCHRONIZED connection.close(); }
+        switchState(SRV_STATE_LISTENING);
+    }
+
+    // Launch the server if requested
+    if (runRequest && isOff()) {
+
+        switchState(SRV_STATE_STARTING);
+        switchState(SRV_STATE_LISTENING);
+    }
+
+    // Open the sockets if we are listening without a listener
+    if (isListening() && !listener.isOpen() && !connection.isOpen()) {
 
-    while (isListening()) {
-        
         try {
-            
-            try {
-                
-                // Try to be a client by connecting to an existing server
-                connection.connect(config.port);
-                debug(SRV_DEBUG, "Acting as a client\n");
-                
-            } catch (...) {
-                
-                // If there is no existing server, be the server
-                debug(SRV_DEBUG, "Acting as a server\n");
-                
-                // Create a port listener
-                listener.bind(config.port);
-                listener.listen();
-                
-                // Wait for a client to connect
-                connection = listener.accept();
-            }
-            
-            // Handle the session
-            sessionLoop();
-            
-            // Close the port listener
-            listener.close();
-            
+
+            establish();
+
         } catch (std::exception &err) {
-            
-            debug(SRV_DEBUG, "Main loop interrupted\n");
 
-            // Handle error if we haven't been interrupted purposely
-            if (!isStopping()) handleError(err.what());
+            debug(SRV_DEBUG, "Can't establish connection: %s\n", err.what());
+
+            closeSockets();
+            handleError(err.what());
+            runRequest = false;
+            switchState(SRV_STATE_OFF);
         }
     }
-    
-    switchState(SRV_STATE_OFF);
 }
 
 void
-RemoteServer::sessionLoop()
+RemoteServer::establish()
 {
-    switchState(SRV_STATE_CONNECTED);
-    
-    numReceived = 0;
-    numSent = 0;
+    try {
+
+        // Try to be a client by connecting to an existing server
+        Socket socket;
+        socket.connect(config.port);
+        debug(SRV_DEBUG, "Acting as a client\n");
+
+        {   SYNCHRONIZED connection = std::move(socket); }
+
+    } catch (...) {
 
+        // If there is no existing server, be the server
+        debug(SRV_DEBUG, "Acting as a server\n");
+
+        // Create a port listener (clients are accepted in the I/O thread)
+        listener.bind(config.port);
+        listener.listen();
+        return;
+    }
+
+    startSession();
+}
+
+void
+RemoteServer::handleAccept()
+{
     try {
 
-        // Receive and process packets
-        while (1) { process(receive()); }
-        
+        auto socket = listener.accept();
+        {   SYNCHRONIZED connection = std::move(socket); }
+        startSession();
+
     } catch (std::exception &err) {
 
-        debug(SRV_DEBUG, "Session loop interrupted\n");
+        debug(SRV_DEBUG, "Can't accept client: %s\n", err.what());
+    }
+}
 
-        // Handle error if we haven't been interrupted purposely
-        if (!isStopping()) {
-            
-            handleError(err.what());
-            switchState(SRV_STATE_LISTENING);
-        }
+void
+RemoteServer::handleInput()
+{
+    try {
+
+        auto data = connection.recv();
+
+        {   SYNCHRONIZED inbox += data; }
+
+        // Inform the emulator thread about the new data
+        announce();
+
+    } catch (std::exception &err) {
+
+        debug(SRV_DEBUG, "Session interrupted\n");
+
+        {   SYNCHRONIZED connection.close(); }
+        handleError(err.what());
+        switchState(SRV_STATE_LISTENING);
+    }
+}
+
+bool
+RemoteServer::announce()
+{
+    {   SYNCHRONIZED
+
+        if (announced || inbox.empty()) return true;
+        announced = true;
     }
 
-    numReceived = 0;
-    numSent = 0;
+    auto success = emulator.put(Cmd(CMD_SRV_RECEIVE, objid));
+    emulator.wakeUp();
+
+    // If the command queue is full, the I/O thread tries again later
+    if (!success) { SYNCHRONIZED announced = false; }
+
+    return success;
+}
+
+void
+RemoteServer::startSession()
+{
+    {   SYNCHRONIZED
+
+        inbox.clear();
+        numReceived = 0;
+        numSent = 0;
+    }
+
+    switchState(SRV_STATE_CONNECTED);
+}
+
+void
+RemoteServer::closeSockets()
+{
+    SYNCHRONIZED
 
     connection.close();
+    listener.close();
 }
 
 void
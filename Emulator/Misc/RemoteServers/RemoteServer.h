@@ -12,8 +12,7 @@
 #include "RemoteServerTypes.h"
 #include "SubComponent.h"
 #include "Socket.h"
-#include "Thread.h"
-#include <thread>
+#include <atomic>
 
 namespace vamiga {
 
@@ -49,15 +48,23 @@ protected:
     // Current configuration
     ServerConfig config = {};
 
-    // Sockets
+    // Sockets (owned by the I/O thread of the remote manager)
     Socket listener;
     Socket connection;
 
-    // The server thread
-    std::thread serverThread;
-
-    // The current server state
+    // The current server state (only changed by the I/O thread)
     SrvState state = SRV_STATE_OFF;
+
+    // Requests handled by the I/O thread
+    std::atomic<bool> runRequest = false;
+    std::atomic<bool> restartRequest = false;
+    std::atomic<bool> disconnectRequest = false;
+
+    // Received data that hasn't been processed by the emulator thread yet
+    string inbox;
+
+    // Indicates that a CMD_SRV_RECEIVE command for the inbox is on its way
+    bool announced = false;
     
     // The number of sent and received packets
     isize numSent = 0;
@@ -71,7 +78,6 @@ protected:
 public:
     
     RemoteServer(Amiga& ref, isize objid);
-    ~RemoteServer() { shutDownServer(); }
     void shutDownServer();
     
     RemoteServer& operator= (const RemoteServer& other) {
@@ -164,9 +170,9 @@ public:
 protected:
 
     // Called from disconnect(), start() and stop()
-    void _start() throws;
-    void _stop() throws;
-    void _disconnect() throws;
+    void _start();
+    void _stop();
+    void _disconnect();
     
     // Switches the internal state
     void switchState(SrvState newState);
@@ -175,20 +181,37 @@ private:
     
     // Used by the launch daemon to determine if actions should be taken
     virtual bool shouldRun() { return true; }
+
+    // Used by the I/O thread to determine if more data can be received
+    virtual bool canReceive() { return true; }
         
     
     //
-    // Running the server
+    // Running the server (called by the I/O thread)
     //
     
 private:
     
-    // The main thread function
-    void main();
+    // Processes pending start, stop, and disconnect requests
+    void handleRequests();
+
+    // Connects to an existing server or opens a port listener
+    void establish() throws;
 
-    // Inner loops (called from main)
-    void mainLoop() throws;
-    void sessionLoop();
+    // Accepts a client
+    void handleAccept();
+
+    // Reads data from the connection and hands it over to the emulator
+    void handleInput();
+
+    // Informs the emulator thread about new data (returns false on failure)
+    bool announce();
+
+    // Starts a new session
+    void startSession();
+
+    // Closes both sockets
+    void closeSockets();
     
     
     //
@@ -196,9 +219,9 @@ private:
     //
     
 public:
-    
-    // Receives or packet
-    string receive() throws;
+
+    // Processes all received data (called by the emulator thread)
+    void processInbox();
     
     // Sends a packet
     void send(const string &payload) throws;
@@ -229,7 +252,7 @@ private:
 
 private:
     
-    virtual string doReceive() throws = 0;
+    virtual void doReceive(const string &data) throws = 0;
     virtual void doSend(const string &payload) throws = 0;
     virtual void doProcess(const string &payload) throws = 0;
     
@@ -45,18 +45,16 @@ RshServer::didConnect()
     }
 }
 
-string
-RshServer::doReceive()
+void
+RshServer::doReceive(const string &data)
 {
-    string payload = connection.recv();
-    
     // Remove LF and CR (if present)
-    payload = util::rtrim(payload, "\n\r");
+    auto payload = util::rtrim(data, "\n\r");
 
     // Ask the client to delete the input (will be replicated by RetroShell)
     connection.send("\033[A\33[2K\r");
     
-    return payload;
+    process(payload);
 }
 
 void
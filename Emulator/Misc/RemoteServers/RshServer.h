@@ -39,7 +39,7 @@ private:
     // Methods from RemoteServer
     //
     
-    string doReceive() throws override;
+    void doReceive(const string &data) throws override;
     void doProcess(const string &packet) throws override;
     void doSend(const string &packet)throws  override;
     void didStart() override;
@@ -37,6 +37,8 @@ SerServer::_dump(Category category, std::ostream& os) const
         os << dec(lostBytes) << std::endl;
         os << tab("Buffered bytes");
         os << dec(buffer.count()) << std::endl;
+        os << tab("Pending bytes");
+        os << dec(isize(outgoing.size())) << std::endl;
     }
 }
 
@@ -46,28 +48,63 @@ SerServer::shouldRun()
     return serialPort.getOption(OPT_SER_DEVICE) == SPD_NULLMODEM;
 }
 
-string
-SerServer::doReceive()
+bool
+SerServer::canReceive()
 {
-    auto result = connection.recv();
-    receivedBytes += (isize)result.size();
+    SYNCHRONIZED
+
+    // Stop reading from the socket if the buffer can't take another chunk
+    return buffer.free() >= (isize)inbox.size() + Socket::BUFFER_SIZE;
+}
+
+void
+SerServer::doReceive(const string &data)
+{
+    receivedBytes += (isize)data.size();
     
     if (config.verbose) {
-        retroShell << "R: " << util::makePrintable(result) << "\n";
+        retroShell << "R: " << util::makePrintable(data) << "\n";
     }
 
-    return result;
+    process(data);
 }
 
 void
 SerServer::doSend(const string &packet)
 {
-    transmittedBytes += (isize)packet.size();
-    connection.send(packet);
-    
-    if (config.verbose) {
-        retroShell << "T: " << util::makePrintable(packet) << "\n";
+    if (outgoing.empty()) outgoingSince = agnus.clock;
+    outgoing += packet;
+
+    // In bulk mode, bytes are collected and transmitted in larger chunks
+    if (!serialPort.getConfig().bulk || isize(outgoing.size()) >= maxBatch) flush();
+}
+
+void
+SerServer::flush()
+{
+    SYNCHRONIZED
+
+    if (outgoing.empty()) return;
+
+    try {
+
+        if (isConnected()) {
+
+            transmittedBytes += (isize)outgoing.size();
+            connection.send(outgoing);
+
+            if (config.verbose) {
+                retroShell << "T: " << util::makePrintable(outgoing) << "\n";
+            }
+        }
+
+    } catch (Error &err) {
+
+        // The I/O thread notices the broken connection on its own
+        debug(SRV_DEBUG, "Can't send: %s\n", err.what());
     }
+
+    outgoing.clear();
 }
 
 void
@@ -79,17 +116,23 @@ SerServer::doProcess(const string &packet)
 void
 SerServer::processIncomingByte(u8 byte)
 {
-    if (!buffer.isFull()) {
+    /* Note: The I/O thread stops reading from the socket if the buffer runs
+     * full (see canReceive()). This throttles the sender via TCP flow control.
+     */
+    {   SYNCHRONIZED
 
-        buffer.write(byte);
-        
-        // When enough bytes have been received, leave buffering mode
-        if (buffer.count() >= 8) buffering = false;
+        if (!buffer.isFull()) {
 
-    } else {
+            buffer.write(byte);
 
-        lostBytes++;
-        debug(SRV_DEBUG, "Buffer overflow\n");
+            // When enough bytes have been received, leave buffering mode
+            if (buffer.count() >= 8) buffering = false;
+
+        } else {
+
+            lostBytes++;
+            debug(SRV_DEBUG, "Buffer overflow\n");
+        }
     }
 }
 
@@ -99,6 +142,8 @@ SerServer::didConnect()
     SUSPENDED
 
     // Start a new sessing
+    {   SYNCHRONIZED buffer.clear(); }
+    outgoing.clear();
     skippedTransmissions = 0;
     receivedBytes = 0;
     transmittedBytes = 0;
@@ -123,26 +168,32 @@ void
 SerServer::serviceSerEvent()
 {
     assert(agnus.id[SLOT_SER] == SER_RECEIVE);
-    
-    if (buffer.isEmpty()) {
-        
-        // Enter buffering mode if we run dry
-        buffering = true;
 
-    } else if (buffering) {
-        
-        // Exit buffering mode if now new symbols came in for quite a while
-        if (++skippedTransmissions > 8) buffering = false;
+    // Transmit outgoing bytes that have been held back for too long
+    if (!outgoing.empty() && agnus.clock - outgoingSince >= maxDelay) flush();
+
+    {   SYNCHRONIZED
+
+        if (buffer.isEmpty()) {
+
+            // Enter buffering mode if we run dry
+            buffering = true;
 
-    } else {
+        } else if (buffering) {
 
-        // Hand the oldest buffer element over to the UART
-        uart.receiveShiftReg = buffer.read();
-        uart.copyFromReceiveShiftRegister();
-        processedBytes++;
-        skippedTransmissions = 0;
+            // Exit buffering mode if now new symbols came in for quite a while
+            if (++skippedTransmissions > 8) buffering = false;
+
+        } else {
+
+            // Hand the oldest buffer element over to the UART
+            uart.receiveShiftReg = buffer.read();
+            uart.copyFromReceiveShiftRegister();
+            processedBytes++;
+            skippedTransmissions = 0;
+        }
     }
-    
+
     scheduleNextEvent();
 }
 
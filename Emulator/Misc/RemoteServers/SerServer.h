@@ -16,8 +16,20 @@ namespace vamiga {
 
 class SerServer final : public RemoteServer {
 
+    // Maximum number of outgoing bytes collected in bulk mode
+    static constexpr isize maxBatch = 4096;
+
+    // Maximum time an outgoing byte is held back in bulk mode
+    static constexpr Cycle maxDelay = MSEC(5);
+
     // A ringbuffer for buffering incoming bytes
-    util::SortedRingBuffer <u8, 8096> buffer;
+    util::RingBuffer <u8, 0x10000> buffer;
+
+    // Outgoing bytes that haven't been handed over to the socket yet
+    string outgoing;
+
+    // Time stamp of the oldest byte in the outgoing buffer
+    Cycle outgoingSince = 0;
     
     /* Indicates if we are currenty running in buffering mode. In this mode,
      * incoming bytes are collected in the ring buffer withous passing them
@@ -66,7 +78,8 @@ private:
 public:
     
     bool shouldRun() override;
-    string doReceive() override;
+    bool canReceive() override;
+    void doReceive(const string &data) override;
     void doSend(const string &packet) override;
     void doProcess(const string &packet) override;
     void didConnect() override;
@@ -74,6 +87,9 @@ public:
 
     void processIncomingByte(u8 byte);
 
+    // Hands all collected outgoing bytes over to the socket
+    void flush();
+
     
     //
     // Servicing events
@@ -26,6 +26,7 @@ Socket::Socket(SOCKET id) : socket(id)
 Socket::Socket(Socket&& other)
 {
     socket = other.socket;
+    outBuffer = std::move(other.outBuffer);
     other.socket = INVALID_SOCKET;
 }
 
@@ -37,6 +38,7 @@ Socket& Socket::operator=(Socket&& other)
 
         close();
         socket = other.socket;
+        outBuffer = std::move(other.outBuffer);
         other.socket = INVALID_SOCKET;
     }
     return *this;
@@ -149,12 +151,11 @@ Socket::accept()
 std::string
 Socket::recv()
 {    
-    char buffer[BUFFER_SIZE + 1] = {};
+    char buffer[BUFFER_SIZE];
     if (auto n = ::recv(socket, buffer, BUFFER_SIZE, 0); n > 0) {
         
         // Convert the buffer to a string
-        string result = string(buffer, n);
-        return result;
+        return string(buffer, n);
     }
     
     throw Error(VAERROR_SOCK_CANT_RECEIVE);
@@ -163,17 +164,37 @@ Socket::recv()
 void
 Socket::send(u8 value)
 {
-    if (::send(socket, (const char *)&value, 1, 0) < 1) {
-        throw Error(VAERROR_SOCK_CANT_SEND);
-    }
+    write(value);
+    flush();
 }
 
 void
 Socket::send(const string &s)
 {
-    if (::send(socket, s.c_str(), (int)s.length(), 0) < 0) {
-        throw Error(VAERROR_SOCK_CANT_SEND);
+    write(s);
+    flush();
+}
+
+void
+Socket::flush()
+{
+    auto data = outBuffer.data();
+    auto remaining = (isize)outBuffer.size();
+
+    // Transmit all data with as few system calls as possible
+    while (remaining > 0) {
+
+        auto n = ::send(socket, data, (int)remaining, 0);
+        if (n <= 0) {
+
+            outBuffer.clear();
+            throw Error(VAERROR_SOCK_CANT_SEND);
+        }
+        data += n;
+        remaining -= n;
     }
+
+    outBuffer.clear();
 }
 
 void
@@ -36,10 +36,13 @@ class Socket : public CoreObject {
 
     SOCKET socket;
 
+    // Outgoing data that hasn't been transmitted yet
+    string outBuffer;
+
 public:
     
-    // Size of the communication buffer
-    static constexpr isize BUFFER_SIZE = 512;
+    // Size of the receive buffer
+    static constexpr isize BUFFER_SIZE = 16384;
     
     
     //
@@ -58,6 +61,12 @@ public:
 
     void create();
 
+    // Returns the underlying socket handle
+    SOCKET getId() const { return socket; }
+
+    // Checks whether the socket is open
+    bool isOpen() const { return socket != INVALID_SOCKET; }
+
     
     //
     // Methods from CoreObject
@@ -89,9 +98,19 @@ public:
 public:
     
     string recv();
+
+    // Transmits data immediately
     void send(u8 value);
     void send(char c) { send((u8)c); }
     void send(const string &s);
+
+    // Collects data in the output buffer
+    void write(u8 value) { outBuffer += (char)value; }
+    void write(char c) { outBuffer += c; }
+    void write(const string &s) { outBuffer += s; }
+
+    // Transmits the contents of the output buffer
+    void flush() throws;
 };
 
 }
@@ -15,7 +15,7 @@
 
 namespace vamiga {
 
-string Command::currentGroup;
+thread_local string Command::currentGroup;
 
 void
 Command::add(const std::vector<string> &tokens,
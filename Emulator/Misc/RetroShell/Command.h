@@ -44,8 +44,8 @@ static const std::string string     = "<string>";
 
 struct Command {
 
-    // Used during command registration
-    static string currentGroup;
+    // Used during command registration (each thread registers its own commands)
+    static thread_local string currentGroup;
 
     // Group of this command
     string groupName;
@@ -176,6 +176,44 @@ CommandConsole::initCommands(Command &root)
             emulator.powerOff();
             emulator.set(scheme);
         });
+
+        root.add({cmd, "rewind"}, { Arg::nr },
+                 "Restores a frame from the rewind buffer",
+                 [this](Arguments& argv, long value) {
+
+            amiga.rewind(parseNum(argv[0]));
+        });
+
+        root.add({cmd, "movie"},
+                 "Records and replays input events");
+
+        root.add({cmd, "movie", "record"},
+                 "Starts logging all input events",
+                 [this](Arguments& argv, long value) {
+
+            amiga.startInputRecording();
+        });
+
+        root.add({cmd, "movie", "stop"},
+                 "Stops logging input events",
+                 [this](Arguments& argv, long value) {
+
+            amiga.stopInputRecording();
+        });
+
+        root.add({cmd, "movie", "save"}, { Arg::path },
+                 "Saves the recorded input events",
+                 [this](Arguments& argv, long value) {
+
+            amiga.saveMovie(argv[0]);
+        });
+
+        root.add({cmd, "movie", "play"}, { Arg::path },
+                 "Replays a movie file",
+                 [this](Arguments& argv, long value) {
+
+            amiga.replayMovie(argv[0]);
+        });
         
         
         //
@@ -376,14 +414,13 @@ CommandConsole::initCommands(Command &root)
                      "Presses a joystick button",
                      [this](Arguments& argv, long value) {
                 
-                auto &port = (value == 0) ? amiga.controlPort1 : amiga.controlPort2;
                 auto nr = parseNum(argv[0]);
                 
                 switch (nr) {
                         
-                    case 1: port.joystick.trigger(PRESS_FIRE); break;
-                    case 2: port.joystick.trigger(PRESS_FIRE2); break;
-                    case 3: port.joystick.trigger(PRESS_FIRE3); break;
+                    case 1: emulator.put(Cmd(CMD_JOY_EVENT, GamePadCmd { .port = value, .action = PRESS_FIRE })); break;
+                    case 2: emulator.put(Cmd(CMD_JOY_EVENT, GamePadCmd { .port = value, .action = PRESS_FIRE2 })); break;
+                    case 3: emulator.put(Cmd(CMD_JOY_EVENT, GamePadCmd { .port = value, .action = PRESS_FIRE3 })); break;
                         
                     default:
                         throw Error(VAERROR_OPT_INV_ARG, "1...3");
@@ -395,14 +432,13 @@ CommandConsole::initCommands(Command &root)
                      "Releases a joystick button",
                      [this](Arguments& argv, long value) {
                 
-                auto &port = (value == 0) ? amiga.controlPort1 : amiga.controlPort2;
                 auto nr = parseNum(argv[0]);
                 
                 switch (nr) {
                         
-                    case 1: port.joystick.trigger(RELEASE_FIRE); break;
-                    case 2: port.joystick.trigger(RELEASE_FIRE2); break;
-                    case 3: port.joystick.trigger(RELEASE_FIRE3); break;
+                    case 1: emulator.put(Cmd(CMD_JOY_EVENT, GamePadCmd { .port = value, .action = RELEASE_FIRE })); break;
+                    case 2: emulator.put(Cmd(CMD_JOY_EVENT, GamePadCmd { .port = value, .action = RELEASE_FIRE2 })); break;
+                    case 3: emulator.put(Cmd(CMD_JOY_EVENT, GamePadCmd { .port = value, .action = RELEASE_FIRE3 })); break;
                         
                     default:
                         throw Error(VAERROR_OPT_INV_ARG, "1...3");
@@ -417,8 +453,7 @@ CommandConsole::initCommands(Command &root)
                      "Pulls the joystick left",
                      [this](Arguments& argv, long value) {
                 
-                auto &port = (value == 0) ? amiga.controlPort1 : amiga.controlPort2;
-                port.joystick.trigger(PULL_LEFT);
+                emulator.put(Cmd(CMD_JOY_EVENT, GamePadCmd { .port = value, .action = PULL_LEFT }));
                 
             }, i);
             
@@ -426,8 +461,7 @@ CommandConsole::initCommands(Command &root)
                      "Pulls the joystick right",
                      [this](Arguments& argv, long value) {
                 
-                auto &port = (value == 0) ? amiga.controlPort1 : amiga.controlPort2;
-                port.joystick.trigger(PULL_RIGHT);
+                emulator.put(Cmd(CMD_JOY_EVENT, GamePadCmd { .port = value, .action = PULL_RIGHT }));
                 
             }, i);
             
@@ -435,8 +469,7 @@ CommandConsole::initCommands(Command &root)
                      "Pulls the joystick up",
                      [this](Arguments& argv, long value) {
                 
-                auto &port = (value == 0) ? amiga.controlPort1 : amiga.controlPort2;
-                port.joystick.trigger(PULL_UP);
+                emulator.put(Cmd(CMD_JOY_EVENT, GamePadCmd { .port = value, .action = PULL_UP }));
                 
             }, i);
             
@@ -444,8 +477,7 @@ CommandConsole::initCommands(Command &root)
                      "Pulls the joystick down",
                      [this](Arguments& argv, long value) {
                 
-                auto &port = (value == 0) ? amiga.controlPort1 : amiga.controlPort2;
-                port.joystick.trigger(PULL_DOWN);
+                emulator.put(Cmd(CMD_JOY_EVENT, GamePadCmd { .port = value, .action = PULL_DOWN }));
                 
             }, i);
             
@@ -456,8 +488,7 @@ CommandConsole::initCommands(Command &root)
                      "Releases the x-axis",
                      [this](Arguments& argv, long value) {
                 
-                auto &port = (value == 0) ? amiga.controlPort1 : amiga.controlPort2;
-                port.joystick.trigger(RELEASE_X);
+                emulator.put(Cmd(CMD_JOY_EVENT, GamePadCmd { .port = value, .action = RELEASE_X }));
                 
             }, i);
             
@@ -465,8 +496,7 @@ CommandConsole::initCommands(Command &root)
                      "Releases the y-axis",
                      [this](Arguments& argv, long value) {
                 
-                auto &port = (value == 0) ? amiga.controlPort1 : amiga.controlPort2;
-                port.joystick.trigger(RELEASE_Y);
+                emulator.put(Cmd(CMD_JOY_EVENT, GamePadCmd { .port = value, .action = RELEASE_Y }));
                 
             }, i);
         }
@@ -488,8 +518,8 @@ CommandConsole::initCommands(Command &root)
                      "Presses the left mouse button",
                      [this](Arguments& argv, long value) {
                 
-                auto &port = (value == 0) ? amiga.controlPort1 : amiga.controlPort2;
-                port.mouse.pressAndReleaseLeft();
+                emulator.put(Cmd(CMD_MOUSE_EVENT, GamePadCmd { .port = value, .action = PRESS_LEFT }));
+                emulator.put(Cmd(CMD_MOUSE_EVENT, GamePadCmd { .port = value, .action = RELEASE_LEFT, .delay = 0.5 }));
                 
             }, i);
             
@@ -497,8 +527,8 @@ CommandConsole::initCommands(Command &root)
                      "Presses the middle mouse button",
                      [this](Arguments& argv, long value) {
                 
-                auto &port = (value == 0) ? amiga.controlPort1 : amiga.controlPort2;
-                port.mouse.pressAndReleaseMiddle();
+                emulator.put(Cmd(CMD_MOUSE_EVENT, GamePadCmd { .port = value, .action = PRESS_MIDDLE }));
+                emulator.put(Cmd(CMD_MOUSE_EVENT, GamePadCmd { .port = value, .action = RELEASE_MIDDLE, .delay = 0.5 }));
                 
             }, i);
             
@@ -506,8 +536,8 @@ CommandConsole::initCommands(Command &root)
                      "Presses the right mouse button",
                      [this](Arguments& argv, long value) {
                 
-                auto &port = (value == 0) ? amiga.controlPort1 : amiga.controlPort2;
-                port.mouse.pressAndReleaseRight();
+                emulator.put(Cmd(CMD_MOUSE_EVENT, GamePadCmd { .port = value, .action = PRESS_RIGHT }));
+                emulator.put(Cmd(CMD_MOUSE_EVENT, GamePadCmd { .port = value, .action = RELEASE_RIGHT, .delay = 0.5 }));
                 
             }, i);
         }
@@ -652,8 +682,55 @@ CommandConsole::initCommands(Command &root)
             amiga.exportDiff(ss);
             *this << ss;
         });
-        
-        
+
+
+        //
+        // Miscellaneous (Profiler)
+        //
+
+        root.add({"profile"},
+                 "Host time profiler");
+
+        root.add({"profile", ""},
+                 "Displays the host time spent in each component",
+                 [this](Arguments& argv, long value) {
+
+            std::stringstream ss;
+            amiga.profiler.dump(ss);
+            *this << ss;
+        });
+
+        root.add({"profile", "histogram"},
+                 "Displays the distribution of the host time per frame",
+                 [this](Arguments& argv, long value) {
+
+            std::stringstream ss;
+            amiga.profiler.dumpHistogram(ss);
+            *this << ss;
+        });
+
+        root.add({"profile", "on"},
+                 "Starts profiling with the next frame",
+                 [this](Arguments& argv, long value) {
+
+            amiga.profiler.enable();
+        });
+
+        root.add({"profile", "off"},
+                 "Stops profiling at the end of the current frame",
+                 [this](Arguments& argv, long value) {
+
+            amiga.profiler.disable();
+        });
+
+        root.add({"profile", "reset"},
+                 "Discards all measurements",
+                 [this](Arguments& argv, long value) {
+
+            amiga.profiler.reset();
+        });
+
+
         //
         // Miscellaneous (Host)
         //
@@ -12,6 +12,7 @@
 #include "Emulator.h"
 #include "Parser.h"
 #include "Option.h"
+#include <algorithm>
 #include <istream>
 #include <sstream>
 #include <string>
@@ -114,8 +115,6 @@ Console::operator<<(std::stringstream &stream)
 const char *
 Console::text()
 {
-    static string all;
-
     // Add the storage contents
     storage.text(all);
 
@@ -125,6 +124,23 @@ Console::text()
     return all.c_str();
 }
 
+const char *
+Console::changes(isize &first, isize &from)
+{
+    // The last line is always included, because the input line may have changed
+    first = storage.firstLine();
+    from = std::clamp(storage.dirtyLine(), storage.firstLine(), storage.lastLine());
+
+    // Add the modified lines
+    storage.text(all, from);
+    storage.clean();
+
+    // Add the input line
+    all += input + " ";
+
+    return all.c_str();
+}
+
 void
 Console::tab(isize pos)
 {
@@ -87,6 +87,9 @@ protected:
     // Input line
     string input;
 
+    // Text buffer returned by text()
+    string all;
+
     // Cursor position
     isize cursor = 0;
 
@@ -167,6 +170,11 @@ public:
     // Returns the contents of the whole storage as a single C string
     const char *text();
 
+    // Returns all lines starting with the first line modified since the last
+    // call. 'first' is set to the number of the oldest stored line and 'from'
+    // to the number of the first returned line.
+    const char *changes(isize &first, isize &from);
+
     // Moves the cursor forward to a certain column
     void tab(isize pos);
 
@@ -1157,6 +1157,85 @@ DebugConsole::initCommands(Command &root)
                 diagBoard.setOption(OPT_DIAG_BOARD, parseBool(argv[0]));
             });
         }
+
+        //
+        // Guest profiler
+        //
+
+        root.add({"gprof"},
+                 "Profile guest code");
+
+        {
+            root.add({"gprof", ""},
+                     "Display the most expensive code locations",
+                     [this](Arguments& argv, long value) {
+
+                std::stringstream ss;
+                amiga.guestProfiler.dump(ss);
+                retroShell << ss;
+            });
+
+            root.add({"gprof", "start"}, { }, { "<interval>" },
+                     "Start profiling (sample every <interval> cycles)",
+                     [this](Arguments& argv, long value) {
+
+                amiga.startGuestProfiling(parseNum(argv, 0, 0));
+            });
+
+            root.add({"gprof", "stop"},
+                     "Stop profiling",
+                     [this](Arguments& argv, long value) {
+
+                amiga.stopGuestProfiling();
+            });
+
+            root.add({"gprof", "clear"},
+                     "Delete all samples",
+                     [this](Arguments& argv, long value) {
+
+                amiga.guestProfiler.clear();
+            });
+
+            root.add({"gprof", "save"}, { Arg::path },
+                     "Save the profile in collapsed stack format",
+                     [this](Arguments& argv, long value) {
+
+                amiga.saveGuestProfile(argv[0]);
+            });
+        }
+
+        //
+        // Instruction tracer
+        //
+
+        root.add({"trace"},
+                 "Write a binary instruction trace");
+
+        {
+            root.add({"trace", ""},
+                     "Display the tracer state",
+                     [this](Arguments& argv, long value) {
+
+                std::stringstream ss;
+                ss << "Tracing: " << (amiga.tracer.isOpen() ? "yes" : "no") << std::endl;
+                ss << "Written: " << amiga.tracer.written() / 1024 << " KB" << std::endl;
+                retroShell << ss;
+            });
+
+            root.add({"trace", "start"}, { Arg::path }, { "<MB>" },
+                     "Start tracing (default file size is 64 MB)",
+                     [this](Arguments& argv, long value) {
+
+                amiga.startTracing(argv[0], MB(parseNum(argv, 1, 64)));
+            });
+
+            root.add({"trace", "stop"},
+                     "Stop tracing and close the trace file",
+                     [this](Arguments& argv, long value) {
+
+                amiga.stopTracing();
+            });
+        }
     }
 
     //
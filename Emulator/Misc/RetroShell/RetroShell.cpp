@@ -68,11 +68,13 @@ RetroShell::enterCommander()
 void
 RetroShell::asyncExec(const string &command, bool append)
 {
+    SYNCHRONIZED
+
     // Feed the command into the command queue
     if (append) {
         commands.push_back({ 0, command});
     } else {
-        commands.insert(commands.begin(), { 0, command});
+        commands.push_front({ 0, command});
     }
 
     // Process the command queue in the next update cycle
@@ -157,8 +159,8 @@ RetroShell::exec()
 
         while (!commands.empty()) {
 
-            cmd = commands.front();
-            commands.erase(commands.begin());
+            cmd = std::move(commands.front());
+            commands.pop_front();
             exec(cmd);
         }
 
@@ -169,7 +171,7 @@ RetroShell::exec()
     } catch (...) {
 
         // Remove all remaining commands
-        commands = { };
+        commands.clear();
 
         msgQueue.put(MSG_RSH_ERROR);
     }
@@ -276,6 +278,12 @@ RetroShell::text()
     return current->text();
 }
 
+const char *
+RetroShell::changes(isize &first, isize &from)
+{
+    return current->changes(first, from);
+}
+
 isize
 RetroShell::cursorRel()
 {
@@ -15,6 +15,7 @@
 #include "TextStorage.h"
 #include <sstream>
 #include <fstream>
+#include <deque>
 #include <functional>
 
 /* RetroShell is a text-based command shell capable of controlling the emulator.
@@ -63,7 +64,7 @@ public:
 private:
     
     // Command queue (stores all pending commands)
-    std::vector<QueuedCmd> commands;
+    std::deque<QueuedCmd> commands;
 
     // The currently active console
     Console *current = &commander;
@@ -167,6 +168,7 @@ public:
     RetroShell &operator<<(std::stringstream &stream);
 
     const char *text();
+    const char *changes(isize &first, isize &from);
     isize cursorRel();
     void press(RetroShellKey key, bool shift = false);
     void press(char c);
@@ -17,79 +17,99 @@ string
 TextStorage::operator [] (isize i) const
 {
     assert(i >= 0 && i < size());
-    return storage[i];
+    return lines[(first + i) % capacity];
 }
 
 string&
 TextStorage::operator [] (isize i)
 {
     assert(i >= 0 && i < size());
-    return storage[i];
+    return lines[(first + i) % capacity];
 }
 
 void
-TextStorage::text(string &all)
+TextStorage::text(string &all) const
 {
-    auto count = size();
-    
-    all = "";
-    for (isize i = 0; i < count; i++) {
-        
-        all += storage[i];
-        if (i < count - 1) all += '\n';
+    text(all, first);
+}
+
+void
+TextStorage::text(string &all, isize from) const
+{
+    from = std::max(from, first);
+
+    // Compute the required space to avoid reallocations
+    isize bytes = 0;
+    for (isize nr = from; nr <= lastLine(); nr++) bytes += isize(lines[nr % capacity].size()) + 1;
+
+    all.clear();
+    all.reserve(bytes);
+
+    for (isize nr = from; nr <= lastLine(); nr++) {
+
+        all += lines[nr % capacity];
+        if (nr < lastLine()) all += '\n';
     }
 }
 
 void
 TextStorage::clear()
 {
-    storage.clear();
-    storage.push_back("");
+    // Continue with a fresh line number
+    first += count;
+    count = 0;
+    dirty = first;
+
+    append("");
 }
 
 bool
 TextStorage::isCleared()
 {
-    return storage.size() == 1 && storage[0].size() == 0;
+    return count == 1 && back().empty();
 }
 
 bool 
 TextStorage::lastLineIsEmpty()
 {
-    return storage.back().empty();
+    return back().empty();
 }
 
 void
 TextStorage::append(const string &line)
 {
-    storage.push_back(line);
+    auto nr = first + count;
+
+    // Drop the oldest line if the storage is full
+    if (count == capacity) first++; else count++;
 
-    // Remove old entries if the storage grows too large
-    while (storage.size() > capacity) storage.erase(storage.begin());
+    lines[nr % capacity] = line;
+    touch(nr);
 }
 
 TextStorage&
 TextStorage::operator<<(char c)
 {
-    assert(!storage.empty());
+    assert(count > 0);
 
     switch (c) {
             
         case '\n':
             
-            if (ostream) *ostream << storage.back() << std::endl;
+            if (ostream) *ostream << back() << std::endl;
 
             append("");
             break;
             
         case '\r':
 
-            storage.back() = "";
+            back().clear();
+            touch(lastLine());
             break;
             
         default:
             
-            if (isprint(c)) storage.back() += c;
+            if (isprint(c)) { back() += c; touch(lastLine()); }
             break;
     }
     
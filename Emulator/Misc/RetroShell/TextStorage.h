@@ -16,13 +16,29 @@
 
 namespace vamiga {
 
+/* The text storage keeps the lines in a ring buffer. Each line is identified
+ * by a line number which is incremented with each new line and never reused.
+ * Line n is stored in slot n % capacity. If the buffer is full, the oldest
+ * line is dropped. The storage also records the first line that has been
+ * modified since the last call to clean(). This allows front ends to fetch
+ * the modified lines instead of the whole contents.
+ */
 class TextStorage {
 
     // Maximum number of stored lines
-    static constexpr usize capacity = 512;
+    static constexpr isize capacity = 512;
     
     // The stored lines
-    std::vector<string> storage;
+    std::vector<string> lines = std::vector<string>(capacity);
+
+    // Line number of the oldest stored line
+    isize first = 0;
+
+    // Number of stored lines
+    isize count = 0;
+
+    // Line number of the first modified line
+    isize dirty = 0;
 
 public:
     
@@ -37,14 +53,42 @@ public:
 public:
     
     // Returns the number of stored lines
-    isize size() const { return (isize)storage.size(); }
+    isize size() const { return count; }
 
-    // Returns a single line
+    // Returns the line numbers of the oldest and the most recent line
+    isize firstLine() const { return first; }
+    isize lastLine() const { return first + count - 1; }
+
+    // Returns a single line (0 = oldest stored line)
     string operator [] (isize i) const;
     string& operator [] (isize i);
 
     // Returns the whole storage contents
-    void text(string &all);
+    void text(string &all) const;
+
+    // Returns all lines starting at a certain line number
+    void text(string &all, isize from) const;
+
+
+    //
+    // Tracking modifications
+    //
+
+public:
+
+    // Returns the line number of the first modified line
+    isize dirtyLine() const { return dirty; }
+
+    // Marks all lines as unmodified
+    void clean() { dirty = first + count; }
+
+private:
+
+    // Marks a line as modified
+    void touch(isize nr) { if (nr < dirty) dirty = nr; }
+
+    // Returns the most recent line
+    string &back() { return lines[lastLine() % capacity]; }
 
     
     //
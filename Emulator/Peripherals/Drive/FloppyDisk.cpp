@@ -10,6 +10,7 @@
 #include "config.h"
 #include "FloppyDisk.h"
 #include "FloppyFile.h"
+#include "MediaCache.h"
 
 namespace vamiga {
 
@@ -38,7 +39,13 @@ void
 FloppyDisk::init(const class FloppyFile &file, bool wp)
 {
     init(file.getDiameter(), file.getDensity(), wp);
-    encodeDisk(file);
+
+    // Try to restore a previously encoded image before running the encoder
+    if (!MediaCache::load(*this, file)) {
+
+        encodeDisk(file);
+        MediaCache::save(*this, file);
+    }
 }
 
 void
@@ -206,16 +213,29 @@ FloppyDisk::writeByte(Cylinder c, Head h, isize offset, u8 value)
     setModified(true);
 }
 
+const u8 *
+FloppyDisk::noise()
+{
+    // The pattern is computed once and shared by all disks
+    static const std::vector<u8> pattern = []() {
+
+        std::vector<u8> result(sizeof(data.raw));
+
+        srand(0);
+        for (auto &byte : result) byte = rand() & 0xFF;
+        return result;
+    }();
+
+    return pattern.data();
+}
+
 void
 FloppyDisk::clearDisk()
 {
     setModified(FORCE_DISK_MODIFIED);
 
     // Initialize with random data
-    srand(0);
-    for (isize i = 0; i < isizeof(data.raw); i++) {
-        data.raw[i] = rand() & 0xFF;
-    }
+    memcpy(data.raw, noise(), sizeof(data.raw));
     
     /* In order to make some copy protected game titles work, we smuggle in
      * some magic values. E.g., Crunch factory expects 0x44A2 on cylinder 80.
@@ -242,10 +262,7 @@ FloppyDisk::clearTrack(Track t)
 {
     assert(t < numTracks());
 
-    srand(0);
-    for (isize i = 0; i < length.track[t]; i++) {
-        data.track[t][i] = rand() & 0xFF;
-    }
+    memcpy(data.track[t], noise(), length.track[t]);
 }
 
 void
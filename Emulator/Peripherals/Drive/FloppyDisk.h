@@ -59,6 +59,7 @@ class FloppyDisk : public CoreObject {
     friend class EADFFile;
     friend class IMGFile;
     friend class STFile;
+    friend class MediaCache;
 
 public:
     
@@ -217,6 +218,11 @@ public:
     // Erasing
     //
     
+private:
+
+    // Returns the random pattern used to initialize unformatted disks
+    static const u8 *noise();
+
 public:
     
     // Initializes the disk with random data
@@ -17,7 +17,8 @@
 
 namespace vamiga {
 
-std::fstream HardDrive::wtStream[4];
+std::set<string> HardDrive::wtPaths;
+util::ReentrantMutex HardDrive::wtMutex;
 
 HardDrive::HardDrive(Amiga& ref, isize nr) : Drive(ref, nr)
 {
@@ -551,7 +552,14 @@ HardDrive::disableWriteThrough()
     if (config.writeThrough) {
 
         // Close file
-        wtStream[objid].close();
+        if (wtStream.is_open()) {
+
+            util::AutoMutex _am(wtMutex);
+
+            wtStream.close();
+            wtPaths.erase(wtPath);
+            wtPath = "";
+        }
         
         debug(WT_DEBUG, "Write-through mode disabled\n");
         config.writeThrough = false;
@@ -561,7 +569,7 @@ HardDrive::disableWriteThrough()
 string
 HardDrive::writeThroughPath()
 {
-    return Emulator::defaults.getRaw("HD" + std::to_string(objid) + "_PATH");
+    return emulator.defaults.getRaw("HD" + std::to_string(objid) + "_PATH");
 }
 
 void
@@ -574,8 +582,10 @@ HardDrive::saveWriteThroughImage()
         throw Error(VAERROR_WT, "No storage path specified");
     }
     
+    util::AutoMutex _am(wtMutex);
+
     // Only proceed if no other emulator instance is using the storage file
-    if (wtStream[objid].is_open()) {
+    if (wtStream.is_open() || wtPaths.contains(path)) {
         throw Error(VAERROR_WT_BLOCKED);
     }
     
@@ -589,10 +599,12 @@ HardDrive::saveWriteThroughImage()
     }
 
     // Open file
-    wtStream[objid].open(path, std::ios::binary | std::ios::in | std::ios::out);
-    if (!wtStream[objid].is_open()) {
+    wtStream.open(path, std::ios::binary | std::ios::in | std::ios::out);
+    if (!wtStream.is_open()) {
         throw Error(VAERROR_WT, "Can't open storage file");
     }
+    wtPaths.insert(path);
+    wtPath = path;
 }
 
 string
@@ -705,10 +717,10 @@ HardDrive::write(isize offset, isize length, u32 addr)
             mem.spypeek <ACCESSOR_CPU> (addr, length, data.ptr + offset);
             
             // Handle write-through mode
-            if (config.writeThrough) {
+            if (config.writeThrough && wtStream.is_open()) {
                 
-                wtStream[objid].seekp(offset);
-                wtStream[objid].write((char *)(data.ptr + offset), length);
+                wtStream.seekp(offset);
+                wtStream.write((char *)(data.ptr + offset), length);
             }
             
             setFlag(FLAG_MODIFIED, true);
@@ -15,6 +15,7 @@
 #include "HdControllerTypes.h"
 #include "HDFFile.h"
 #include "MemUtils.h"
+#include <set>
 
 namespace vamiga {
 
@@ -58,8 +59,18 @@ class HardDrive final : public Drive, public Inspectable<HardDriveInfo> {
     friend class HDFFile;
     friend class HdController;
 
-    // Write-through storage files
-    static std::fstream wtStream[4];
+    // Write-through storage file
+    std::fstream wtStream;
+    string wtPath;
+
+    // Storage files in use by any emulator instance of this process
+    static std::set<string> wtPaths;
+    static util::ReentrantMutex wtMutex;
+
+    // Storage for the traits returned by getTraits() and getPartitionTraits()
+    mutable HardDriveTraits traits = { };
+    mutable PartitionTraits partitionTraits = { };
+    mutable string partitionName;
     
     // Current configuration
     HardDriveConfig config = {};
@@ -129,8 +140,6 @@ public:
 
     const HardDriveTraits &getTraits() const {
 
-        static HardDriveTraits traits;
-
         traits.nr = objid;
         
         traits.diskVendor = diskVendor.c_str();
@@ -157,15 +166,14 @@ public:
 
     const PartitionTraits &getPartitionTraits(isize nr) const {
 
-        static PartitionTraits traits;
-
         auto descr = getPartitionDescriptor(nr);
-        traits.nr = nr;
-        traits.name = descr.name.c_str();
-        traits.lowerCyl = descr.lowCyl;
-        traits.upperCyl = descr.highCyl;
+        partitionName = descr.name;
+        partitionTraits.nr = nr;
+        partitionTraits.name = partitionName.c_str();
+        partitionTraits.lowerCyl = descr.lowCyl;
+        partitionTraits.upperCyl = descr.highCyl;
 
-        return traits;
+        return partitionTraits;
     }
 
 private:
@@ -110,6 +110,7 @@ private:
 
         worker
 
+        << keyDown
         << config.accurate;
 
     } SERIALIZERS(serialize);
@@ -261,11 +261,36 @@ Mouse::setRightButton(bool value)
 }
 
 void
-Mouse::trigger(GamePadAction event)
+Mouse::trigger(GamePadAction event, double delay)
 {
     assert_enum(GamePadAction, event);
 
-    debug(PRT_DEBUG, "trigger(%s)\n", GamePadActionEnum::key(event));
+    debug(PRT_DEBUG, "trigger(%s, %f)\n", GamePadActionEnum::key(event), delay);
+
+    if (delay > 0) {
+
+        // Let the event scheduler perform the action later
+        EventID id = EVENT_NONE;
+
+        switch (event) {
+
+            case PRESS_LEFT: id = MSE_PUSH_LEFT; break;
+            case RELEASE_LEFT: id = MSE_RELEASE_LEFT; break;
+            case PRESS_MIDDLE: id = MSE_PUSH_MIDDLE; break;
+            case RELEASE_MIDDLE: id = MSE_RELEASE_MIDDLE; break;
+            case PRESS_RIGHT: id = MSE_PUSH_RIGHT; break;
+            case RELEASE_RIGHT: id = MSE_RELEASE_RIGHT; break;
+            default: return;
+        }
+
+        // A duration of 0 keeps a pushed button pressed
+        if (port.isPort1()) {
+            agnus.scheduleRel <SLOT_MSE1> (SEC(delay), id, 0);
+        } else {
+            agnus.scheduleRel <SLOT_MSE2> (SEC(delay), id, 0);
+        }
+        return;
+    }
 
     switch (event) {
 
@@ -381,7 +406,11 @@ Mouse::serviceMouseEvent()
         case MSE_PUSH_LEFT:
             
             setLeftButton(true);
-            agnus.scheduleRel<s>(duration, MSE_RELEASE_LEFT);
+            if (duration) {
+                agnus.scheduleRel<s>(duration, MSE_RELEASE_LEFT);
+            } else {
+                agnus.cancel<s>();
+            }
             break;
             
         case MSE_RELEASE_LEFT:
@@ -393,7 +422,11 @@ Mouse::serviceMouseEvent()
         case MSE_PUSH_MIDDLE:
 
             setMiddleButton(true);
-            agnus.scheduleRel<s>(duration, MSE_RELEASE_MIDDLE);
+            if (duration) {
+                agnus.scheduleRel<s>(duration, MSE_RELEASE_MIDDLE);
+            } else {
+                agnus.cancel<s>();
+            }
             break;
 
         case MSE_RELEASE_MIDDLE:
@@ -405,7 +438,11 @@ Mouse::serviceMouseEvent()
         case MSE_PUSH_RIGHT:
             
             setRightButton(true);
-            agnus.scheduleRel<s>(duration, MSE_RELEASE_RIGHT);
+            if (duration) {
+                agnus.scheduleRel<s>(duration, MSE_RELEASE_RIGHT);
+            } else {
+                agnus.cancel<s>();
+            }
             break;
             
         case MSE_RELEASE_RIGHT:
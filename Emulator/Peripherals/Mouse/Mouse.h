@@ -237,8 +237,8 @@ public:
     void setMiddleButton(bool value);
     void setRightButton(bool value);
 
-    // Triggers a gamepad event
-    void trigger(GamePadAction event);
+    // Triggers a gamepad event (button events can be delayed)
+    void trigger(GamePadAction event, double delay = 0.0);
 
     // Performs periodic actions for this device
     void execute();
@@ -8,6 +8,7 @@
 #ifndef __MSDOS
 #include <stdint.h>
 #endif
+#include <stddef.h>
 
 #ifndef UCHAR
   #ifdef __MSDOS
@@ -36,6 +36,13 @@ static USHORT Unpack_Track(UCHAR *, UCHAR *, USHORT, USHORT, UCHAR, UCHAR);
 static void printbandiz(UCHAR *, USHORT);
 static void dms_decrypt(UCHAR *, USHORT);
 USHORT extractDMS(const UCHAR *in, size_t inSize, UCHAR **out, size_t *outSize, int verbose);
+USHORT scanDMS(const UCHAR *in, size_t inSize, size_t *outSize);
+USHORT openDMS(const UCHAR *in, size_t inSize);
+USHORT unpackNextDMSTrack(const UCHAR **out, size_t *outSize);
+void closeDMS(void);
+size_t sizeofDMSState(void);
+void saveDMS(UCHAR *state);
+USHORT restoreDMS(const UCHAR *in, size_t inSize, const UCHAR *state);
 
 static char modes[7][7]={"NOCOMP","SIMPLE","QUICK ","MEDIUM","DEEP  ","HEAVY1","HEAVY2"};
 static USHORT PWDCRC;
@@ -200,6 +207,195 @@ USHORT extractDMS(const UCHAR *in, size_t inSize, UCHAR **out, size_t *outSize,
     return ret;
 }
 
+/* Incremental entry points for vAmiga
+ *
+ * scanDMS() walks through the track headers without unpacking anything and
+ * reports the size of the unpacked disk. openDMS(), unpackNextDMSTrack(), and
+ * closeDMS() unpack the archive track by track. Note that the decrunchers keep
+ * their state in global variables. Hence, only a single archive can be
+ * unpacked at a time. To switch archives in the middle of unpacking,
+ * saveDMS() copies the decoder state into a buffer of sizeofDMSState() bytes
+ * and restoreDMS() continues from there.
+ */
+
+static UCHAR *sb1, *sb2, *stext;
+
+static USHORT Check_Header(const UCHAR *b1)
+{
+    USHORT geninfo, disktype, hcrc;
+
+    if ( (b1[0] != 'D') || (b1[1] != 'M') || (b1[2] != 'S') || (b1[3] != '!') )
+        return ERR_NOTDMS;
+
+    hcrc = (USHORT)((b1[HEADLEN-2]<<8) | b1[HEADLEN-1]);
+    if (hcrc != CreateCRC((UCHAR *)b1+4,(ULONG)(HEADLEN-6)))
+        return ERR_HCRC;
+
+    geninfo = (USHORT) ((b1[10]<<8) | b1[11]);
+    disktype = (USHORT) ((b1[50]<<8) | b1[51]);
+
+    if (disktype == 7) return ERR_FMS;
+    if (geninfo & 2) return ERR_NOPASSWD;
+
+    return NO_PROBLEM;
+}
+
+USHORT scanDMS(const UCHAR *in, size_t inSize, size_t *outSize)
+{
+    const UCHAR *b1;
+    USHORT ret, hcrc, number, pklen1, pklen2, unpklen;
+    size_t pos = HEADLEN;
+
+    *outSize = 0;
+
+    if (inSize < HEADLEN) return ERR_SREAD;
+    if ((ret = Check_Header(in)) != NO_PROBLEM) return ret;
+
+    /*  Mimic the termination conditions of Process_Track  */
+    while (pos < inSize) {
+
+        if (pos + THLEN > inSize) return ERR_SREAD;
+
+        b1 = in + pos;
+        if ((b1[0] != 'T')||(b1[1] != 'R')) break;
+
+        hcrc = (USHORT)((b1[THLEN-2] << 8) | b1[THLEN-1]);
+        if (CreateCRC((UCHAR *)b1,(ULONG)(THLEN-2)) != hcrc) return ERR_THCRC;
+
+        number = (USHORT)((b1[2] << 8) | b1[3]);
+        pklen1 = (USHORT)((b1[6] << 8) | b1[7]);
+        pklen2 = (USHORT)((b1[8] << 8) | b1[9]);
+        unpklen = (USHORT)((b1[10] << 8) | b1[11]);
+
+        if ((pklen1 > TRACK_BUFFER_LEN) || (pklen2 >TRACK_BUFFER_LEN) || (unpklen > TRACK_BUFFER_LEN)) return ERR_BIGTRACK;
+        if (pos + THLEN + pklen1 > inSize) return ERR_SREAD;
+
+        if ((number<80) && (unpklen>2048)) *outSize += unpklen;
+        pos += THLEN + pklen1;
+    }
+
+    return NO_PROBLEM;
+}
+
+static int Alloc_Buffers(void)
+{
+    sb1 = (UCHAR *)calloc((size_t)TRACK_BUFFER_LEN,1);
+    sb2 = (UCHAR *)calloc((size_t)TRACK_BUFFER_LEN,1);
+    text = stext = (UCHAR *)calloc((size_t)TEMP_BUFFER_LEN,1);
+
+    return sb1 && sb2 && stext;
+}
+
+static void Copy_DMS_State(UCHAR *buf, size_t *pos, int mode)
+{
+    Copy_State(buf, pos, &inpos, sizeof(inpos), mode);
+    Copy_State(buf, pos, &PWDCRC, sizeof(PWDCRC), mode);
+    Copy_Decruncher_State(buf, pos, mode);
+}
+
+USHORT openDMS(const UCHAR *in, size_t inSize)
+{
+    USHORT ret;
+
+    closeDMS();
+
+    inbuf = in;
+    insize = inSize;
+    inpos = 0;
+    outpos = 0;
+
+    if (!Alloc_Buffers()) {
+        closeDMS();
+        return ERR_NOMEMORY;
+    }
+
+    if (In_Read(sb1, 1, HEADLEN) != HEADLEN) {
+        closeDMS();
+        return ERR_SREAD;
+    }
+
+    if ((ret = Check_Header(sb1)) != NO_PROBLEM) {
+        closeDMS();
+        return ret;
+    }
+
+    PWDCRC = 0;
+    Init_Decrunchers();
+
+    return NO_PROBLEM;
+}
+
+USHORT unpackNextDMSTrack(const UCHAR **out, size_t *outSize)
+{
+    USHORT ret;
+
+    *out = NULL;
+    *outSize = 0;
+
+    if (!sb1) return ERR_NOMEMORY;
+
+    /*  Skip all tracks that don't contain disk data (banner, FILEID.DIZ, ...)  */
+    outpos = 0;
+    while ( (ret=Process_Track(sb1,sb2,CMD_UNPACK,0,0)) == NO_PROBLEM && outpos == 0 ) ;
+
+    /*  See extractDMS for why we treat this as the end of the archive  */
+    if (ret == ERR_NOTTRACK) ret = FILE_END;
+
+    if (ret == NO_PROBLEM) {
+        *out = outbuf;
+        *outSize = outpos;
+    }
+    return ret;
+}
+
+size_t sizeofDMSState(void)
+{
+    size_t size = 0;
+
+    Copy_DMS_State(NULL, &size, STATE_SAVE);
+    return size;
+}
+
+void saveDMS(UCHAR *state)
+{
+    size_t pos = 0;
+
+    Copy_DMS_State(state, &pos, STATE_SAVE);
+}
+
+USHORT restoreDMS(const UCHAR *in, size_t inSize, const UCHAR *state)
+{
+    size_t pos = 0;
+
+    /*  The scratch buffers carry nothing over and are reused  */
+    if (!sb1 && !Alloc_Buffers()) {
+        closeDMS();
+        return ERR_NOMEMORY;
+    }
+
+    inbuf = in;
+    insize = inSize;
+    outpos = 0;
+    text = stext;
+
+    Copy_DMS_State((UCHAR *)state, &pos, STATE_LOAD);
+    return NO_PROBLEM;
+}
+
+void closeDMS(void)
+{
+    free(sb1);
+    free(sb2);
+    free(stext);
+    free(outbuf);
+
+    /*  extractDMS manages 'text' on its own  */
+    if (text == stext) text = NULL;
+
+    sb1 = sb2 = stext = outbuf = NULL;
+    outpos = 0;
+}
+
 #if 0
 USHORT Process_File(char *iname, char *oname, USHORT cmd, USHORT opt, USHORT PCRC, USHORT pwd){
     FILE *fi, *fo=NULL;
@@ -14,6 +14,7 @@
 #include "cdata.h"
 #include "tables.h"
 #include "u_deep.h"
+#include "u_init.h"
 #include "getbits.h"
 
 
@@ -206,3 +207,10 @@ INLINE void update(USHORT c){
 }
 
 
+/*  Added for vAmiga  */
+void Copy_DEEP_State(UCHAR *buf, size_t *pos, int mode){
+	Copy_State(buf, pos, freq, sizeof(freq), mode);
+	Copy_State(buf, pos, prnt, sizeof(prnt), mode);
+	Copy_State(buf, pos, son, sizeof(son), mode);
+}
+
@@ -4,4 +4,5 @@ USHORT Unpack_DEEP(UCHAR *, UCHAR *, USHORT);
 
 extern int init_deep_tabs;
 extern USHORT deep_text_loc;
+void Copy_DEEP_State(UCHAR *, size_t *, int);
 
@@ -12,6 +12,7 @@
 
 #include "cdata.h"
 #include "u_heavy.h"
+#include "u_init.h"
 #include "getbits.h"
 #include "maketbl.h"
 
@@ -173,3 +174,14 @@ static USHORT read_tree_p(void){
 }
 
 
+/*  Added for vAmiga  */
+void Copy_HEAVY_State(UCHAR *buf, size_t *pos, int mode){
+	Copy_State(buf, pos, left, sizeof(left), mode);
+	Copy_State(buf, pos, right, sizeof(right), mode);
+	Copy_State(buf, pos, c_len, sizeof(c_len), mode);
+	Copy_State(buf, pos, pt_len, sizeof(pt_len), mode);
+	Copy_State(buf, pos, c_table, sizeof(c_table), mode);
+	Copy_State(buf, pos, pt_table, sizeof(pt_table), mode);
+	Copy_State(buf, pos, &np, sizeof(np), mode);
+}
+
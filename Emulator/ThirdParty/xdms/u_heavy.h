@@ -3,4 +3,5 @@
 USHORT Unpack_HEAVY(UCHAR *, UCHAR *, UCHAR, USHORT);
 
 extern USHORT heavy_text_loc, heavy_lastlen;
+void Copy_HEAVY_State(UCHAR *, size_t *, int);
 
@@ -27,3 +27,26 @@ void Init_Decrunchers(void){
 	memset(text,0,0x3fc8);
 }
 
+
+/*  Copies a variable from or to a state buffer (added for vAmiga)  */
+void Copy_State(UCHAR *buf, size_t *pos, void *var, size_t size, int mode){
+	if (buf && mode == STATE_SAVE) memcpy(buf + *pos, var, size);
+	if (buf && mode == STATE_LOAD) memcpy(var, buf + *pos, size);
+	*pos += size;
+}
+
+
+/*  Saves or restores everything the decrunchers carry over from one track
+ *  to the next. The largest dictionary is 16Kb (Medium, Deep).  */
+void Copy_Decruncher_State(UCHAR *buf, size_t *pos, int mode){
+	Copy_State(buf, pos, &quick_text_loc, sizeof(quick_text_loc), mode);
+	Copy_State(buf, pos, &medium_text_loc, sizeof(medium_text_loc), mode);
+	Copy_State(buf, pos, &deep_text_loc, sizeof(deep_text_loc), mode);
+	Copy_State(buf, pos, &init_deep_tabs, sizeof(init_deep_tabs), mode);
+	Copy_State(buf, pos, &heavy_text_loc, sizeof(heavy_text_loc), mode);
+	Copy_State(buf, pos, &heavy_lastlen, sizeof(heavy_lastlen), mode);
+	Copy_State(buf, pos, text, 0x4000, mode);
+	Copy_DEEP_State(buf, pos, mode);
+	Copy_HEAVY_State(buf, pos, mode);
+}
+
@@ -1,3 +1,9 @@
-
 void Init_Decrunchers(void);
 
+/*  State transfer (added for vAmiga). A NULL buffer only measures the size.  */
+#define STATE_LOAD 0
+#define STATE_SAVE 1
+
+void Copy_State(UCHAR *, size_t *, void *, size_t, int);
+void Copy_Decruncher_State(UCHAR *, size_t *, int);
+
@@ -0,0 +1,177 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the Mozilla Public License v2
+//
+// See https://mozilla.org/MPL/2.0 for license information
+// -----------------------------------------------------------------------------
+/// @file
+
+#include "config.h"
+#include "TraceTool.h"
+#include "Emulator.h"
+#include <iomanip>
+#include <iostream>
+
+int main(int argc, char *argv[])
+{
+    try {
+
+        return vamiga::TraceTool().main(argc, argv);
+
+    } catch (vamiga::TraceSyntaxError &e) {
+
+        std::cout << "Usage: vAmigaTrace [-r] [-f <cycle>] [-t <cycle>] [-p <lo>-<hi>] [-g <text>] <trace>" << std::endl;
+        std::cout << std::endl;
+        std::cout << "       -f or --from <cycle>   Skip instructions executed before this cycle" << std::endl;
+        std::cout << "       -t or --to <cycle>     Skip instructions executed after this cycle" << std::endl;
+        std::cout << "       -p or --pc <lo>-<hi>   Only print instructions in this address range" << std::endl;
+        std::cout << "       -g or --grep <text>    Only print instructions containing this text" << std::endl;
+        std::cout << "       -r or --regs           Print the registers changed by each instruction" << std::endl;
+        std::cout << "       <trace>                Trace file written by the emulator" << std::endl;
+        std::cout << std::endl;
+
+        if (auto what = string(e.what()); !what.empty()) {
+            std::cout << what << std::endl;
+        }
+
+    } catch (vamiga::Error &e) {
+
+        std::cout << "VAError: " << e.what() << std::endl;
+
+    } catch (std::exception &e) {
+
+        std::cout << "System Error: " << e.what() << std::endl;
+
+    } catch (...) {
+
+        std::cout << "Error" << std::endl;
+    }
+
+    return 1;
+}
+
+namespace vamiga {
+
+int
+TraceTool::main(int argc, char *argv[])
+{
+    // Parse all command line arguments
+    parseArguments(argc, argv);
+
+    // Read the trace file
+    TraceReader reader;
+    reader.open(keys["trace"]);
+
+    // Setup a disassembler matching the traced CPU
+    VAmiga vamiga;
+    auto &cpu = vamiga.emu->main.cpu;
+    cpu.setOption(OPT_CPU_REVISION, reader.header.cpuModel);
+    cpu.setOption(OPT_CPU_DASM_REVISION, reader.header.dasmModel);
+
+    reader.decode([&](const trace::Record &record) {
+
+        if (regs) printDelta(record);
+        print(cpu, record);
+    });
+
+    if (!pending.empty()) std::cout << pending << std::endl;
+    return 0;
+}
+
+void
+TraceTool::parseArguments(int argc, char *argv[])
+{
+    for (isize i = 1; i < argc; i++) {
+
+        auto arg = string(argv[i]);
+
+        if (arg[0] == '-') {
+
+            if (arg == "-r" || arg == "--regs") { regs = true; continue; }
+
+            if (++i == argc) throw TraceSyntaxError("Missing argument for '" + arg + "'");
+            auto value = string(argv[i]);
+
+            if (arg == "-f" || arg == "--from") { fromCycle = parseNum(value); continue; }
+            if (arg == "-t" || arg == "--to")   { toCycle = parseNum(value); continue; }
+            if (arg == "-g" || arg == "--grep") { pattern = value; continue; }
+
+            if (arg == "-p" || arg == "--pc") {
+
+                auto pos = value.find('-');
+                if (pos == string::npos) throw TraceSyntaxError("Invalid address range '" + value + "'");
+                fromPC = u32(parseNum(value.substr(0, pos)));
+                toPC = u32(parseNum(value.substr(pos + 1)));
+                continue;
+            }
+
+            throw TraceSyntaxError("Invalid option '" + arg + "'");
+        }
+
+        if (keys.find("trace") != keys.end()) throw TraceSyntaxError("More than one trace file is given");
+        keys["trace"] = std::filesystem::absolute(std::filesystem::path(arg)).string();
+    }
+
+    if (keys.find("trace") == keys.end()) throw TraceSyntaxError("");
+}
+
+i64
+TraceTool::parseNum(const string &arg) const
+{
+    try {
+
+        size_t pos;
+        auto result = std::stoll(arg, &pos, 0);
+        if (pos == arg.size()) return result;
+
+    } catch (...) { }
+
+    throw TraceSyntaxError("Invalid number '" + arg + "'");
+}
+
+void
+TraceTool::print(CPU &cpu, const trace::Record &record)
+{
+    // Flush the previous line
+    if (!pending.empty()) std::cout << pending << std::endl;
+    pending.clear();
+
+    // Apply filters
+    if (record.clock < fromCycle || record.clock > toCycle) return;
+    if (record.pc < fromPC || record.pc > toPC) return;
+
+    auto instr = cpu.disassembleInstr(record.pc, record.words, trace::maxWords, nullptr);
+    if (!pattern.empty() && string(instr).find(pattern) == string::npos) return;
+
+    std::stringstream ss;
+    ss << std::setw(12) << record.clock << "  ";
+    ss << std::hex << std::uppercase << std::setfill('0') << std::setw(6) << record.pc << "  ";
+    ss << std::setw(4) << record.sr << "  " << instr;
+    pending = ss.str();
+}
+
+void
+TraceTool::printDelta(const trace::Record &record)
+{
+    // The first record of a block contains all registers
+    if (pending.empty() || record.mask == 0xFFFF) return;
+
+    std::stringstream ss;
+    ss << std::hex << std::uppercase << std::setfill('0');
+
+    for (isize i = 0; i < 16; i++) {
+
+        if (record.mask & (1 << i)) {
+
+            ss << (i < 8 ? "  D" : "  A") << (i & 7) << "=" << std::setw(8) << record.regs[i];
+        }
+    }
+
+    if (auto delta = ss.str(); !delta.empty()) {
+        pending += std::string(std::max(isize(0), 56 - isize(pending.size())), ' ') + delta;
+    }
+}
+
+}
@@ -0,0 +1,76 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the Mozilla Public License v2
+//
+// See https://mozilla.org/MPL/2.0 for license information
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "VAmiga.h"
+#include "TraceFile.h"
+#include <map>
+
+namespace vamiga {
+
+struct TraceSyntaxError : public std::runtime_error {
+    using runtime_error::runtime_error;
+};
+
+/* vAmigaTrace disassembles the binary instruction traces written by the
+ * emulator. It creates an emulator instance of its own, configures the CPU
+ * model stored in the trace file, and feeds the recorded instruction words
+ * into the disassembler. Memory is never accessed, so the output is correct
+ * even if the traced code has been overwritten in the meantime.
+ */
+class TraceTool {
+
+    // Parsed command line arguments
+    std::map<string,string> keys;
+
+    // Filter settings
+    i64 fromCycle = 0;
+    i64 toCycle = INT64_MAX;
+    u32 fromPC = 0;
+    u32 toPC = UINT32_MAX;
+    string pattern;
+    bool regs = false;
+
+    // The most recently formatted line (printed with the next record)
+    string pending;
+
+
+    //
+    // Launching
+    //
+
+public:
+
+    // Main entry point
+    int main(int argc, char *argv[]);
+
+private:
+
+    // Parses the command line arguments
+    void parseArguments(int argc, char *argv[]);
+
+    // Converts a number in decimal or hexadecimal notation
+    i64 parseNum(const string &arg) const;
+
+
+    //
+    // Decoding
+    //
+
+private:
+
+    // Prints a single record
+    void print(CPU &cpu, const trace::Record &record);
+
+    // Prints the registers that differ from the previous record
+    void printDelta(const trace::Record &record);
+};
+
+}
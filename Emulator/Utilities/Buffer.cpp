@@ -11,6 +11,7 @@
 #include "Buffer.h"
 #include "IOUtils.h"
 #include "MemUtils.h"
+#include <algorithm>
 #include <fstream>
 
 namespace vamiga::util {
@@ -85,9 +86,7 @@ Allocator<T>::init(const T *buf, isize elements)
     
     if (ptr) {
         
-        for (isize i = 0; i < size; i++) {
-            ptr[i] = buf[i];
-        }
+        std::copy(buf, buf + size, ptr);
     }
 }
 
@@ -194,9 +193,7 @@ Allocator<T>::copy(T *buf, isize offset, isize len) const
     
     if (ptr) {
         
-        for (isize i = 0; i < len; i++) {
-            buf[i] = ptr[i + offset];
-        }
+        std::copy(ptr + offset, ptr + offset + len, buf);
     }
 }
 
@@ -10,6 +10,7 @@
 #pragma once
 
 #include "Chrono.h"
+#include <atomic>
 #include <thread>
 #include <future>
 
@@ -47,4 +48,87 @@ public:
     ~AutoMutex() { mutex.unlock(); }
 };
 
+/* Bounded lock-free queue for multiple producers and a single consumer. Each
+ * slot carries a sequence number that tells producers and the consumer whether
+ * the slot is free or holds a published element. Producers claim slots with a
+ * compare-and-swap on the write position; the consumer owns the read position
+ * and never writes to it concurrently. With a single producer, the queue
+ * behaves like a classic SPSC ring buffer and the CAS never fails.
+ */
+template <class T, isize capacity> class MPSCQueue
+{
+    static_assert((capacity & (capacity - 1)) == 0, "Capacity must be a power of 2");
+
+    struct Slot {
+
+        std::atomic<isize> seq;
+        T element;
+    };
+
+    Slot slots[capacity];
+
+    // Write position (shared by all producers)
+    alignas(64) std::atomic<isize> w = 0;
+
+    // Read position (owned by the consumer)
+    alignas(64) std::atomic<isize> r = 0;
+
+public:
+
+    MPSCQueue() { for (isize i = 0; i < capacity; i++) slots[i].seq = i; }
+
+    // Checks if the queue is empty (exact for the consumer only)
+    bool isEmpty() const {
+
+        auto pos = r.load(std::memory_order_relaxed);
+        return slots[pos & (capacity - 1)].seq.load(std::memory_order_acquire) != pos + 1;
+    }
+
+    // Returns an approximation of the number of stored elements
+    isize count() const {
+
+        auto result = w.load(std::memory_order_relaxed) - r.load(std::memory_order_relaxed);
+        return result < 0 ? 0 : result > capacity ? capacity : result;
+    }
+
+    // Appends an element (returns false if the queue is full)
+    bool write(const T &element) {
+
+        auto pos = w.load(std::memory_order_relaxed);
+        Slot *slot;
+
+        while (true) {
+
+            slot = &slots[pos & (capacity - 1)];
+            auto diff = slot->seq.load(std::memory_order_acquire) - pos;
+
+            if (diff == 0) {
+                if (w.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = w.load(std::memory_order_relaxed);
+            }
+        }
+
+        slot->element = element;
+        slot->seq.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Removes the oldest element (returns false if the queue is empty)
+    bool read(T &element) {
+
+        auto pos = r.load(std::memory_order_relaxed);
+        auto &slot = slots[pos & (capacity - 1)];
+
+        if (slot.seq.load(std::memory_order_acquire) != pos + 1) return false;
+
+        element = slot.element;
+        slot.seq.store(pos + capacity, std::memory_order_release);
+        r.store(pos + 1, std::memory_order_relaxed);
+        return true;
+    }
+};
+
 }
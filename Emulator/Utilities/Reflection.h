@@ -58,7 +58,7 @@ template <class T, typename E> struct Reflection {
     // Returns a textual representation for a bit mask
     static const char *mask(isize mask) {
 
-        static string result;
+        thread_local string result;
         result = "";
 
         if (isBitField()) {
@@ -11,6 +11,7 @@
 #include "VAmiga.h"
 #include "Emulator.h"
 #include "GuardList.h"
+#include "MediaCache.h"
 
 namespace vamiga {
 
@@ -847,15 +848,7 @@ KeyboardAPI::isPressed(KeyCode key) const
 void
 KeyboardAPI::press(KeyCode key, double delay, double duration)
 {
-    if (delay == 0.0) {
-
-        keyboard->press(key);
-        emu->isDirty = true;
-
-    } else {
-        
-        emu->put(Cmd(CMD_KEY_PRESS, KeyCmd { .keycode = key, .delay = delay }));
-    }
+    emu->put(Cmd(CMD_KEY_PRESS, KeyCmd { .keycode = key, .delay = delay }));
     if (duration != 0.0) {
         
         emu->put(Cmd(CMD_KEY_RELEASE, KeyCmd { .keycode = key, .delay = delay + duration }));
@@ -865,15 +858,7 @@ KeyboardAPI::press(KeyCode key, double delay, double duration)
 void
 KeyboardAPI::toggle(KeyCode key, double delay, double duration)
 {
-    if (delay == 0.0) {
-        
-        keyboard->toggle(key);
-        emu->isDirty = true;
-        
-    } else {
-        
-        emu->put(Cmd(CMD_KEY_TOGGLE, KeyCmd { .keycode = key, .delay = delay }));
-    }
+    emu->put(Cmd(CMD_KEY_TOGGLE, KeyCmd { .keycode = key, .delay = delay }));
     if (duration != 0.0) {
         
         emu->put(Cmd(CMD_KEY_TOGGLE, KeyCmd { .keycode = key, .delay = delay + duration }));
@@ -883,15 +868,7 @@ KeyboardAPI::toggle(KeyCode key, double delay, double duration)
 void
 KeyboardAPI::release(KeyCode key, double delay)
 {
-    if (delay == 0.0) {
-        
-        keyboard->release(key);
-        emu->isDirty = true;
-        
-    } else {
-        
-        emu->put(Cmd(CMD_KEY_RELEASE, KeyCmd { .keycode = key, .delay = delay }));
-    }
+    emu->put(Cmd(CMD_KEY_RELEASE, KeyCmd { .keycode = key, .delay = delay }));
 }
 
 void
@@ -1448,6 +1425,12 @@ RetroShellAPI::text()
     return retroShell->text();
 }
 
+const char *
+RetroShellAPI::changes(isize &first, isize &from)
+{
+    return retroShell->changes(first, from);
+}
+
 isize
 RetroShellAPI::cursorRel()
 {
@@ -1664,6 +1647,18 @@ VAmiga::build()
     return Amiga::build();
 }
 
+void
+VAmiga::setMediaCache(const std::filesystem::path &path)
+{
+    MediaCache::setDirectory(path);
+}
+
+std::filesystem::path
+VAmiga::getMediaCache()
+{
+    return MediaCache::getDirectory();
+}
+
 const EmulatorInfo &
 VAmiga::getInfo() const
 {
@@ -1930,6 +1925,86 @@ AmigaAPI::loadSnapshot(const MediaFile &snapshot)
     amiga->loadSnapshot(snapshot);
     emu->isDirty = true;
 }
+
+i64
+AmigaAPI::firstRecordedFrame() const
+{
+    return amiga->rewindBuffer.firstFrame();
+}
+
+i64
+AmigaAPI::lastRecordedFrame() const
+{
+    return amiga->rewindBuffer.lastFrame();
+}
+
+void
+AmigaAPI::rewind(i64 frame)
+{
+    amiga->rewind(frame);
+    emu->isDirty = true;
+}
+
+void
+AmigaAPI::startInputRecording()
+{
+    amiga->startInputRecording();
+}
+
+void
+AmigaAPI::stopInputRecording()
+{
+    amiga->stopInputRecording();
+}
+
+isize
+AmigaAPI::recordedInputEvents() const
+{
+    return amiga->inputRecorder.count();
+}
+
+void
+AmigaAPI::saveMovie(const std::filesystem::path &path)
+{
+    amiga->saveMovie(path);
+}
+
+void
+AmigaAPI::replayMovie(const std::filesystem::path &path)
+{
+    amiga->replayMovie(path);
+    emu->isDirty = true;
+}
+
+void
+AmigaAPI::startGuestProfiling(isize interval)
+{
+    amiga->startGuestProfiling(interval);
+}
+
+void
+AmigaAPI::stopGuestProfiling()
+{
+    amiga->stopGuestProfiling();
+}
+
+void
+AmigaAPI::saveGuestProfile(const std::filesystem::path &path)
+{
+    amiga->saveGuestProfile(path);
+}
+
+void
+AmigaAPI::startTracing(const std::filesystem::path &path, isize bytes)
+{
+    amiga->startTracing(path, bytes);
+}
+
+void
+AmigaAPI::stopTracing()
+{
+    amiga->stopTracing();
+}
     
 u64
 AmigaAPI::getAutoInspectionMask() const
@@ -96,6 +96,116 @@ struct AmigaAPI : public API {
      */
     void loadSnapshot(const MediaFile &snapshot);
 
+    /// @}
+    /// @name Rewinding
+    /// @{
+
+    /** @brief  Returns the first frame stored in the rewind buffer.
+     *
+     *  Frames are only recorded if option AMIGA.REWIND is enabled.
+     *
+     *  @return The frame number or -1 if the buffer is empty.
+     */
+    i64 firstRecordedFrame() const;
+
+    /** @brief  Returns the last frame stored in the rewind buffer.
+     *
+     *  @return The frame number or -1 if the buffer is empty.
+     */
+    i64 lastRecordedFrame() const;
+
+    /** @brief  Restores a frame from the rewind buffer.
+     *
+     *  @param  frame   Number of the frame to restore.
+     *  @throw  Error (VAERROR_SNAP_UNAVAILABLE)
+     */
+    void rewind(i64 frame);
+
+    /// @}
+    /// @name Recording inputs
+    /// @{
+
+    /** @brief  Starts logging all input events.
+     *
+     *  The current state is saved as the starting point of the movie.
+     */
+    void startInputRecording();
+
+    /** @brief  Stops logging input events.
+     */
+    void stopInputRecording();
+
+    /** @brief  Returns the number of recorded input events.
+     */
+    isize recordedInputEvents() const;
+
+    /** @brief  Writes the recorded input events to a movie file.
+     *
+     *  @param  path    Path of the movie file.
+     *  @throw  Error (VAERROR_FILE_CANT_WRITE, VAERROR_FILE_CANT_CREATE)
+     */
+    void saveMovie(const std::filesystem::path &path);
+
+    /** @brief  Replays a movie file.
+     *
+     *  The emulator reverts to the state at the beginning of the movie and
+     *  feeds in all recorded input events at their original cycles. Live
+     *  input is ignored until the end of the movie is reached, which is
+     *  signalled by MSG_REPLAY_FINISHED.
+     *
+     *  @param  path    Path of the movie file.
+     *  @throw  Error (VAERROR_FILE_NOT_FOUND, VAERROR_FILE_TYPE_MISMATCH)
+     */
+    void replayMovie(const std::filesystem::path &path);
+
+    /// @}
+    /// @name Profiling guest code
+    /// @{
+
+    /** @brief  Starts the guest profiler.
+     *
+     *  @param  interval    Sampling interval in CPU cycles. If 0 is passed
+     *                      in, the cycles of each instruction are counted.
+     */
+    void startGuestProfiling(isize interval = 0);
+
+    /** @brief  Stops the guest profiler.
+     */
+    void stopGuestProfiling();
+
+    /** @brief  Writes the profile in collapsed stack format.
+     *
+     *  Each line lists the running task, the code module, and the code
+     *  location, separated by semicolons, followed by the number of consumed
+     *  CPU cycles. The format is understood by most flame graph tools.
+     *
+     *  @param  path    Path of the output file.
+     *  @throw  Error (VAERROR_FILE_CANT_WRITE, VAERROR_FILE_CANT_CREATE)
+     */
+    void saveGuestProfile(const std::filesystem::path &path);
+
+    /// @}
+    /// @name Tracing instructions
+    /// @{
+
+    /** @brief  Starts writing a binary instruction trace.
+     *
+     *  The emulator records the address, the status register, the opcode
+     *  words, and all changed data and address registers of each executed
+     *  instruction. The trace file is organized as a ring buffer. If it is
+     *  full, the oldest records are overwritten. Use vAmigaTrace to
+     *  disassemble the file.
+     *
+     *  @param  path    Path of the trace file.
+     *  @param  bytes   Size of the trace file.
+     *  @throw  Error (VAERROR_FILE_CANT_CREATE, VAERROR_FILE_CANT_WRITE)
+     */
+    void startTracing(const std::filesystem::path &path, isize bytes);
+
+    /** @brief  Stops writing the instruction trace and closes the file.
+     */
+    void stopTracing();
+
     /// @}
     /// @name Auto-inspecting components
     /// @{
@@ -1285,6 +1395,17 @@ struct RetroShellAPI : public API {
      */
     const char *text();
 
+    /** @brief  Returns the modified part of the text buffer.
+     *  The returned text starts with the first line that has been modified
+     *  since the last call and ends with the input line. Lines are numbered
+     *  consecutively. On return, 'first' contains the number of the oldest
+     *  line in the buffer and 'from' the number of the first returned line.
+     *  Front ends may drop all lines below 'first', replace all lines
+     *  starting at 'from' by the returned text, and keep the rest. After
+     *  switching consoles, the complete text should be fetched via text().
+     */
+    const char *changes(isize &first, isize &from);
+
     /** @brief  Returns the relative cursor position.
      *  The returned value is relative to the end of the input line. A value
      *  of 0 indicates that the cursor is at the rightmost position, that
@@ -1477,6 +1598,20 @@ public:
      */
     static string build();
 
+    /** @brief  Enables the media cache.
+     *
+     *  When a cache directory is set, the MFM encoded images of all inserted
+     *  floppy disks are stored on the host. Inserting the same file again
+     *  restores the image from the cache instead of encoding it again.
+     *
+     *  @param  path    Cache directory. An empty path disables the cache.
+     */
+    static void setMediaCache(const std::filesystem::path &path);
+
+    /** @brief  Returns the current media cache directory.
+     */
+    static std::filesystem::path getMediaCache();
+
     
     //
     // Initializing
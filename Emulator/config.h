@@ -23,7 +23,7 @@
 #define SNP_MAJOR 3
 #define SNP_MINOR 0
 #define SNP_SUBMINOR 0
-#define SNP_BETA 2
+#define SNP_BETA 3
 
 // Uncomment this setting in a release build
 // #define RELEASEBUILD
@@ -66,8 +66,10 @@
 // Execution settings
 //
 
-static const int DIAG_BOARD      = 0; // Plug in the diagnose board
-static const int ALLOW_ALL_ROMS  = 0; // Disable the magic bytes check
+static const int DIAG_BOARD       = 0; // Plug in the diagnose board
+static const int ALLOW_ALL_ROMS   = 0; // Disable the magic bytes check
+static const int DMS_ASYNC_DECODE = 1; // Unpack DMS archives in the background
+static const int MEM_STATS        = 1; // Record memory access statistics
 
 
 //